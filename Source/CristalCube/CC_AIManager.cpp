@@ -6,35 +6,115 @@
 #include "Characters/CC_EnemyCharacter.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
-#include "TimerManager.h"
 #include "CC_EnemyManager.h"
+#include "CC_EnemyMovementComponent.h"
+#include "CC_EnemySpawner.h"
+#include "CC_EnemyPoolSubsystem.h"
+#include "CC_EnemyRegistry.h"
+#include "CC_WorldWrap.h"
+#include "CC_Stats.h"
 
 
+void FCC_AITierBucket::Add(ACC_EnemyCharacter* Enemy, const FCC_AISteeringCache& Cache)
+{
+	FCC_AIRegistrySlot& Slot = Enemy->GetAIRegistrySlot();
+	Slot.Tier = static_cast<uint8>(Tier);
+	Slot.TierIndex = Enemies.Add(Enemy);
+	Steering.Add(Cache);
+}
+
+void FCC_AITierBucket::RemoveAtSwap(int32 Index)
+{
+	if (ACC_EnemyCharacter* Removed = Enemies[Index])
+	{
+		Removed->GetAIRegistrySlot().TierIndex = INDEX_NONE;
+	}
+
+	Enemies.RemoveAtSwap(Index, EAllowShrinking::No);
+	Steering.RemoveAtSwap(Index, EAllowShrinking::No);
+
+	if (Enemies.IsValidIndex(Index) && Enemies[Index])
+	{
+		Enemies[Index]->GetAIRegistrySlot().TierIndex = Index;
+	}
+}
+
 void UCC_AIManager::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
+	TierBuckets.SetNum(static_cast<int32>(ECC_AILODTier::Count));
+	for (int32 TierIndex = 0; TierIndex < TierBuckets.Num(); ++TierIndex)
+	{
+		TierBuckets[TierIndex].Tier = static_cast<ECC_AILODTier>(TierIndex);
+	}
+
+	// Decisions and steering run before the tick groups so movement components consume them the same frame
+	PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &UCC_AIManager::OnWorldPreActorTick);
+
+	// This subsystem outlives the world - drop everything that belongs to it on level travel
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(this, &UCC_AIManager::OnWorldCleanup);
+
 	UE_LOG(LogTemp, Log, TEXT("CristalCubeAIManager initialized"));
 }
 
 void UCC_AIManager::Deinitialize()
 {
-	// Clean up timer
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(AIBatchUpdateTimer);
-	}
+	FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
 
-	// Clear enemy arrays
-	ActiveEnemies.Empty();
-	ActiveAIEnemies.Empty();
-	SleepingEnemies.Empty();
+	ResetWorldState();
 
 	UE_LOG(LogTemp, Log, TEXT("CristalCubeAIManager deinitialized"));
 
 	Super::Deinitialize();
 }
 
+void UCC_AIManager::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	if (!World || World != GetWorld())
+	{
+		return;
+	}
+
+	ResetWorldState();
+
+	UE_LOG(LogTemp, Log, TEXT("CristalCubeAIManager cleared for world cleanup: %s"), *World->GetName());
+}
+
+void UCC_AIManager::ResetWorldState()
+{
+	SteeringBatch.Reset();
+	DecisionBatch.Reset();
+	PendingTierMoves.Reset();
+
+	// Proxies point at this world's spawners and positions
+	ProxyStore.Reset();
+	FlowField.Reset();
+	FMemory::Memzero(DecisionCursors);
+	StaleScanTier = 0;
+	StaleScanIndex = 0;
+
+	// Clear enemy arrays (every registered enemy sits in exactly one bucket)
+	for (FCC_AITierBucket& Bucket : TierBuckets)
+	{
+		for (ACC_EnemyCharacter* Enemy : Bucket.Enemies)
+		{
+			if (Enemy)
+			{
+				Enemy->GetAIRegistrySlot() = FCC_AIRegistrySlot();
+			}
+		}
+	}
+
+	ActiveEnemies.Reset();
+	ActiveAIEnemies.Empty();
+	for (FCC_AITierBucket& Bucket : TierBuckets)
+	{
+		Bucket.Empty();
+	}
+}
+
 void UCC_AIManager::RegisterEnemy(ACC_EnemyCharacter* Enemy)
 {
 	if (!Enemy)
@@ -43,30 +123,31 @@ void UCC_AIManager::RegisterEnemy(ACC_EnemyCharacter* Enemy)
 		return;
 	}
 
-	if (ActiveEnemies.Contains(Enemy))
+	const FCC_EnemyHandle& Handle = Enemy->GetEnemyHandle();
+	if (!Handle.IsSet())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Enemy has no registry handle: %s"), *Enemy->GetName());
+		return;
+	}
+
+	if (!ActiveEnemies.Add(Handle))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("Enemy already registered: %s"), *Enemy->GetName());
 		return;
 	}
 
-	ActiveEnemies.Add(Enemy);
+	// Starts near (solves on the first frame), its first decision moves it to its real tier.
+	// Due at once but not stale, so a spawn wave is spread over the decision budget
+	FCC_AISteeringCache Cache;
+	Cache.NextDecisionTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+	Cache.LastDecisionFrame = GFrameCounter;
+	GetTierBucket(ECC_AILODTier::Near).Add(Enemy, Cache);
 
-	// Start the batch timer if this is the first enemy
-	if (ActiveEnemies.Num() == 1)
-	{
-		if (UWorld* World = GetWorld())
-		{
-			World->GetTimerManager().SetTimer(
-				AIBatchUpdateTimer,
-				this,
-				&UCC_AIManager::BatchUpdateAI,
-				AIUpdateFrequency,
-				true  // Loop
-			);
+	// Movement and facing come from UpdateSteering - the enemy's own Tick is only the fallback
+	Enemy->SetActorTickEnabled(false);
+	SetMovementManaged(Enemy, true);
 
-			UE_LOG(LogTemp, Log, TEXT("AI Manager started batch processing (%.2fs interval)"), AIUpdateFrequency);
-		}
-	}
+	ApplyCrowdCollision(Enemy);
 
 	UE_LOG(LogTemp, Log, TEXT("Enemy registered: %s (Total: %d)"), *Enemy->GetName(), ActiveEnemies.Num());
 
@@ -79,54 +160,64 @@ void UCC_AIManager::UnregisterEnemy(ACC_EnemyCharacter* Enemy)
 		return;
 	}
 
-	// Remove from all arrays
-	ActiveEnemies.Remove(Enemy);
+	// O(1) through the handle's slot index
+	if (ActiveEnemies.Remove(Enemy->GetEnemyHandle()) == INDEX_NONE)
+	{
+		return;
+	}
+
+	FCC_AIRegistrySlot& Slot = Enemy->GetAIRegistrySlot();
+
 	ActiveAIEnemies.Remove(Enemy);
-	SleepingEnemies.Remove(Enemy);
 
-	// Stop timer if no enemies left
-	if (ActiveEnemies.Num() == 0)
+	if (Slot.TierIndex != INDEX_NONE)
 	{
-		if (UWorld* World = GetWorld())
+		// Dying enemies still need their death animation. Woken before the movement is handed back,
+		// so SetDormant restores the tick state saved while managed instead of overriding it
+		const ECC_AILODTier Tier = static_cast<ECC_AILODTier>(Slot.Tier);
+		if (Tier == ECC_AILODTier::Sleeping)
 		{
-			World->GetTimerManager().ClearTimer(AIBatchUpdateTimer);
-			UE_LOG(LogTemp, Log, TEXT("AI Manager stopped - no enemies remaining"));
+			SetEnemySleeping(Enemy, false);
 		}
+
+		GetTierBucket(Tier).RemoveAtSwap(Slot.TierIndex);
 	}
 
+	// Back on its own Tick fallback (DeactivateEnemy switches it off again after unregistering)
+	Enemy->SetActorTickEnabled(true);
+	SetMovementManaged(Enemy, false);
+
 	UE_LOG(LogTemp, Log, TEXT("Enemy unregistered: %s (Remaining: %d)"), *Enemy->GetName(), ActiveEnemies.Num());
 
 }
 
 void UCC_AIManager::SetUpdateFrequency(float NewFrequency)
 {
+	// Enemies already scheduled keep their next decision time, the new interval applies after it
 	AIUpdateFrequency = FMath::Clamp(NewFrequency, 0.05f, 1.0f);
 
-	// Restart timer with new frequency if active
-	if (ActiveEnemies.Num() > 0)
-	{
-		if (UWorld* World = GetWorld())
-		{
-			World->GetTimerManager().ClearTimer(AIBatchUpdateTimer);
-			World->GetTimerManager().SetTimer(
-				AIBatchUpdateTimer,
-				this,
-				&UCC_AIManager::BatchUpdateAI,
-				AIUpdateFrequency,
-				true
-			);
-		}
-	}
-
 	UE_LOG(LogTemp, Log, TEXT("AI Manager frequency updated to %.2fs"), AIUpdateFrequency);
 
 }
 
+int32 UCC_AIManager::GetTierCount(ECC_AILODTier Tier) const
+{
+	const int32 TierIndex = static_cast<int32>(Tier);
+	return TierBuckets.IsValidIndex(TierIndex) ? TierBuckets[TierIndex].Num() : 0;
+}
+
+float UCC_AIManager::GetTierSteeringTimeMs(ECC_AILODTier Tier) const
+{
+	const int32 TierIndex = static_cast<int32>(Tier);
+	return TierIndex < static_cast<int32>(ECC_AILODTier::Count) ? LastTierSteeringTime[TierIndex] * 1000.0f : 0.0f;
+}
+
 void UCC_AIManager::BatchUpdateAI()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UCristalCubeAIManager::BatchUpdateAI);
+	SCOPE_CYCLE_COUNTER(STAT_CC_AILODUpdate);
 
-	float StartTime = FPlatformTime::Seconds();
+	const double StartTime = FPlatformTime::Seconds();
 
 	// Get player reference once
 	ACC_PlayerCharacter* Player = GetPlayerCharacter();
@@ -137,31 +228,874 @@ void UCC_AIManager::BatchUpdateAI()
 
 	FVector PlayerLocation = Player->GetActorLocation();
 
-	// Clear previous frame's AI arrays
-	ActiveAIEnemies.Empty();
-	SleepingEnemies.Empty();
+	FCC_WorldWrap Wrap;
+	if (ACC_EnemyManager* EnemyManager = ACC_EnemyManager::Get(this))
+	{
+		Wrap = EnemyManager->GetWorldWrap();
+	}
+
+	UpdateFlowField(PlayerLocation, Wrap);
+
+	const UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+	const uint64 Frame = GFrameCounter;
+	const FCC_AILODSettings Settings = GetLODSettings();
+	const EParallelForFlags Flags = GetParallelForFlags();
+	const double Budget = AIDecisionBudgetMs * 0.001;
+
+	// Every slice runs (1) gather on the game thread -> (2) chase / tier decisions
+	// on worker threads -> (3) write back on the game thread
+	auto ProcessSlice = [&]()
+	{
+		EvaluateDecisions(DecisionBatch, PlayerLocation, Wrap, Settings, ParallelMinBatchSize, Flags);
+		return ApplyDecisions(Now, Frame);
+	};
+
+	// Stale enemies first, over budget but capped - a wave that went stale together is spread over frames
+	int32 DeferredCount = 0;
+	const int32 StaleCount = GatherStaleDecisions(Frame, DeferredCount);
+	int32 ProcessedCount = StaleCount > 0 ? ProcessSlice() : 0;
 
-	// Process all enemies in batch
-	int32 ProcessedCount = 0;
-	for (ACC_EnemyCharacter* Enemy : ActiveEnemies)
+	// Then due enemies round-robin, near tier first, chunk by chunk until the budget or the cap runs out
+	while (ProcessedCount < MaxDecisionsPerFrame && FPlatformTime::Seconds() - StartTime < Budget)
 	{
-		if (Enemy && Enemy->IsAlive())
+		if (GatherDueDecisions(Now, Frame, FMath::Min(DecisionChunkSize, MaxDecisionsPerFrame - ProcessedCount)) == 0)
 		{
-			UpdateEnemyAIState(Enemy, PlayerLocation);
-			ProcessedCount++;
+			break;
 		}
+
+		ProcessedCount += ProcessSlice();
 	}
 
+	SET_DWORD_STAT(STAT_CC_AITierNear, GetTierCount(ECC_AILODTier::Near));
+	SET_DWORD_STAT(STAT_CC_AITierMid, GetTierCount(ECC_AILODTier::Mid));
+	SET_DWORD_STAT(STAT_CC_AITierFar, GetTierCount(ECC_AILODTier::Far));
+	SET_DWORD_STAT(STAT_CC_AITierSleeping, GetTierCount(ECC_AILODTier::Sleeping));
+
 	// Performance tracking
 	LastUpdateTime = FPlatformTime::Seconds() - StartTime;
 	LastProcessedCount = ProcessedCount;
 
+	// The last chunk (or the stale pass) can end past the budget
+	if (ProcessedCount > 0 && LastUpdateTime > Budget)
+	{
+		++BudgetOverrunCount;
+	}
+
+	INC_DWORD_STAT_BY(STAT_CC_AIDecisions, ProcessedCount);
+	INC_DWORD_STAT_BY(STAT_CC_AIStaleDecisions, StaleCount);
+	SET_DWORD_STAT(STAT_CC_AIDecisionBacklog, DeferredCount);
+	SET_DWORD_STAT(STAT_CC_AIBudgetOverruns, BudgetOverrunCount);
+
 	// Debug output (remove in shipping build)
 	if (ProcessedCount > 0)
 	{
-		UE_LOG(LogTemp, VeryVerbose, TEXT("AI Batch: %d enemies, %.4fms, Active: %d, Sleeping: %d"),
-			ProcessedCount, LastUpdateTime * 1000.0f, ActiveAIEnemies.Num(), SleepingEnemies.Num());
+		UE_LOG(LogTemp, VeryVerbose, TEXT("AI Slice: %d enemies (%d stale, %d stale deferred), %.4fms, Active: %d, Near: %d, Mid: %d, Far: %d, Sleeping: %d"),
+			ProcessedCount, StaleCount, DeferredCount, LastUpdateTime * 1000.0f, ActiveAIEnemies.Num(),
+			GetTierCount(ECC_AILODTier::Near), GetTierCount(ECC_AILODTier::Mid),
+			GetTierCount(ECC_AILODTier::Far), GetTierCount(ECC_AILODTier::Sleeping));
+	}
+}
+
+int32 UCC_AIManager::GatherStaleDecisions(uint64 Frame, int32& OutDeferredCount)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCC_AIManager::GatherStaleDecisions);
+
+	DecisionBatch.Reset();
+	OutDeferredCount = 0;
+
+	// One sweep over all tiers every half MaxDecisionStaleFrames, a slice of it per frame
+	const int32 StaleWindow = FMath::Max(1, MaxDecisionStaleFrames / 2);
+	int32 ScanBudget = FMath::Max(DecisionChunkSize, FMath::DivideAndRoundUp(ActiveEnemies.Num(), StaleWindow));
+
+	// First stale enemy over the cap - the sweep resumes there next frame
+	int32 ResumeTier = INDEX_NONE;
+	int32 ResumeIndex = INDEX_NONE;
+
+	while (ScanBudget > 0 && StaleScanTier < TierBuckets.Num())
+	{
+		FCC_AITierBucket& Bucket = TierBuckets[StaleScanTier];
+		if (StaleScanIndex >= Bucket.Num())
+		{
+			++StaleScanTier;
+			StaleScanIndex = 0;
+			continue;
+		}
+
+		// Drop a destroyed entry - the swapped-in tail entry has not been gathered yet, check it next
+		ACC_EnemyCharacter* Enemy = Bucket.Enemies[StaleScanIndex];
+		if (!Enemy)
+		{
+			Bucket.RemoveAtSwap(StaleScanIndex);
+			continue;
+		}
+
+		--ScanBudget;
+
+		const FCC_AISteeringCache& Cache = Bucket.Steering[StaleScanIndex];
+		const bool bStale = Cache.LastDecisionFrame != Frame
+			&& Frame - Cache.LastDecisionFrame >= static_cast<uint64>(MaxDecisionStaleFrames);
+		if (bStale && Enemy->IsAlive())
+		{
+			if (DecisionBatch.Num() < MaxStaleDecisionsPerFrame)
+			{
+				AddDecisionInput(StaleScanTier, StaleScanIndex, Enemy);
+			}
+			else if (OutDeferredCount++ == 0)
+			{
+				ResumeTier = StaleScanTier;
+				ResumeIndex = StaleScanIndex;
+			}
+		}
+
+		++StaleScanIndex;
+	}
+
+	if (ResumeTier != INDEX_NONE)
+	{
+		StaleScanTier = ResumeTier;
+		StaleScanIndex = ResumeIndex;
+	}
+	// End of the sweep - start over next frame (never wraps within a frame, so gathered indices stay valid)
+	else if (StaleScanTier >= TierBuckets.Num())
+	{
+		StaleScanTier = 0;
+		StaleScanIndex = 0;
+	}
+
+	DecisionBatch.SetOutputNum();
+	return DecisionBatch.Num();
+}
+
+int32 UCC_AIManager::GatherDueDecisions(double Now, uint64 Frame, int32 MaxCount)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCC_AIManager::GatherDueDecisions);
+
+	DecisionBatch.Reset();
+
+	// Tier order is priority order - farther tiers only get what the nearer ones leave
+	for (int32 TierIndex = 0; TierIndex < TierBuckets.Num() && DecisionBatch.Num() < MaxCount; ++TierIndex)
+	{
+		const FCC_AITierBucket& Bucket = TierBuckets[TierIndex];
+		const int32 NumEnemies = Bucket.Num();
+		if (NumEnemies == 0)
+		{
+			continue;
+		}
+
+		// Tier moves swap entries around, so the cursor is only approximately fair - staleness covers the rest
+		int32& Cursor = DecisionCursors[TierIndex];
+		if (Cursor >= NumEnemies)
+		{
+			Cursor = 0;
+		}
+
+		for (int32 Visited = 0; Visited < NumEnemies && DecisionBatch.Num() < MaxCount; ++Visited)
+		{
+			const int32 Index = Cursor;
+			Cursor = (Cursor + 1) % NumEnemies;
+
+			const ACC_EnemyCharacter* Enemy = Bucket.Enemies[Index];
+			const FCC_AISteeringCache& Cache = Bucket.Steering[Index];
+			if (!Enemy || Cache.LastDecisionFrame == Frame || Now < Cache.NextDecisionTime || !Enemy->IsAlive())
+			{
+				continue;
+			}
+
+			AddDecisionInput(TierIndex, Index, Enemy);
+		}
+	}
+
+	DecisionBatch.SetOutputNum();
+	return DecisionBatch.Num();
+}
+
+void UCC_AIManager::AddDecisionInput(int32 TierIndex, int32 Index, const ACC_EnemyCharacter* Enemy)
+{
+	const FVector Location = Enemy->GetActorLocation();
+	const float DetectionRange = Enemy->GetDetectionRange();
+
+	DecisionBatch.Tier.Add(static_cast<uint8>(TierIndex));
+	DecisionBatch.EnemyIndex.Add(Index);
+	DecisionBatch.X.Add(Location.X);
+	DecisionBatch.Y.Add(Location.Y);
+	DecisionBatch.Z.Add(Location.Z);
+	DecisionBatch.DetectionRangeSq.Add(DetectionRange * DetectionRange);
+}
+
+void UCC_AIManager::EvaluateDecisions(FCC_AIDecisionBatch& Batch, const FVector& PlayerLocation, const FCC_WorldWrap& Wrap,
+	const FCC_AILODSettings& Settings, int32 MinBatchSize, EParallelForFlags Flags)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCC_AIManager::EvaluateDecisions);
+
+	// Every index writes only its own outputs
+	ParallelFor(TEXT("CC_AIDecisions"), Batch.Num(), MinBatchSize, [&Batch, &PlayerLocation, &Wrap, &Settings](int32 i)
+	{
+		const float DistanceSquared = Wrap.DistSquared(FVector(Batch.X[i], Batch.Y[i], Batch.Z[i]), PlayerLocation);
+
+		Batch.bChase[i] = DistanceSquared <= Batch.DetectionRangeSq[i] ? 1 : 0;
+		Batch.NewTier[i] = static_cast<uint8>(GetLODTier(Settings, DistanceSquared, static_cast<ECC_AILODTier>(Batch.Tier[i])));
+	}, Flags);
+}
+
+int32 UCC_AIManager::ApplyDecisions(double Now, uint64 Frame)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCC_AIManager::ApplyDecisions);
+
+	PendingTierMoves.Reset();
+
+	for (int32 i = 0; i < DecisionBatch.Num(); ++i)
+	{
+		const ECC_AILODTier CurrentTier = static_cast<ECC_AILODTier>(DecisionBatch.Tier[i]);
+		const int32 Index = DecisionBatch.EnemyIndex[i];
+
+		FCC_AITierBucket& Bucket = GetTierBucket(CurrentTier);
+		ACC_EnemyCharacter* Enemy = Bucket.Enemies[Index];
+
+		UpdateEnemyAIState(Enemy, DecisionBatch.bChase[i] != 0);
+
+		FCC_AISteeringCache& Cache = Bucket.Steering[Index];
+		Cache.NextDecisionTime = Now + AIUpdateFrequency;
+		Cache.LastDecisionFrame = Frame;
+
+		const ECC_AILODTier NewTier = static_cast<ECC_AILODTier>(DecisionBatch.NewTier[i]);
+		if (NewTier != CurrentTier)
+		{
+			PendingTierMoves.Add({ CurrentTier, Index, NewTier });
+		}
+	}
+
+	// Highest index of each bucket first, so a swap-remove only moves entries that are not pending
+	PendingTierMoves.Sort([](const FCC_AITierMove& A, const FCC_AITierMove& B)
+	{
+		return A.FromTier != B.FromTier ? A.FromTier < B.FromTier : A.Index > B.Index;
+	});
+
+	for (const FCC_AITierMove& Move : PendingTierMoves)
+	{
+		MoveToTier(Move.FromTier, Move.Index, Move.ToTier);
+	}
+
+	return DecisionBatch.Num();
+}
+
+FCC_AILODSettings UCC_AIManager::GetLODSettings() const
+{
+	FCC_AILODSettings Settings;
+	Settings.TierRanges[0] = HighPriorityRange;
+	Settings.TierRanges[1] = MidPriorityRange;
+	Settings.TierRanges[2] = MaxAIRange;
+	Settings.TierHysteresis = TierHysteresis;
+	return Settings;
+}
+
+EParallelForFlags UCC_AIManager::GetParallelForFlags() const
+{
+	return bParallelAI ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+}
+
+ECC_AILODTier UCC_AIManager::GetLODTier(const FCC_AILODSettings& Settings, float DistanceSquared, ECC_AILODTier CurrentTier)
+{
+	int32 Tier = 0;
+	for (; Tier < UE_ARRAY_COUNT(Settings.TierRanges); ++Tier)
+	{
+		// The current tier (and farther ones) reach TierHysteresis past their boundary,
+		// so leaving a tier outward needs a clear margin while coming closer does not
+		float Range = Settings.TierRanges[Tier];
+		if (Tier >= static_cast<int32>(CurrentTier))
+		{
+			Range += Settings.TierHysteresis;
+		}
+
+		if (DistanceSquared <= Range * Range)
+		{
+			break;
+		}
+	}
+
+	return static_cast<ECC_AILODTier>(Tier);
+}
+
+float UCC_AIManager::GetTierUpdateInterval(ECC_AILODTier Tier) const
+{
+	switch (Tier)
+	{
+	case ECC_AILODTier::Mid:
+		return MidUpdateInterval;
+
+	case ECC_AILODTier::Far:
+		return FarUpdateInterval;
+
+	default:
+		return 0.0f;
+	}
+}
+
+void UCC_AIManager::MoveToTier(ECC_AILODTier FromTier, int32 Index, ECC_AILODTier ToTier)
+{
+	FCC_AITierBucket& From = GetTierBucket(FromTier);
+	ACC_EnemyCharacter* Enemy = From.Enemies[Index];
+
+	// Keep moving along the last solution, re-solve somewhere inside the new tier's interval
+	// so a wave crossing a boundary together doesn't solve in the same frame
+	FCC_AISteeringCache Cache = From.Steering[Index];
+	const UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+	Cache.NextSolveTime = Now + FMath::FRand() * GetTierUpdateInterval(ToTier);
+
+	From.RemoveAtSwap(Index);
+	GetTierBucket(ToTier).Add(Enemy, Cache);
+
+	if (FromTier == ECC_AILODTier::Sleeping || ToTier == ECC_AILODTier::Sleeping)
+	{
+		SetEnemySleeping(Enemy, ToTier == ECC_AILODTier::Sleeping);
+	}
+}
+
+void UCC_AIManager::SetEnemySleeping(ACC_EnemyCharacter* Enemy, bool bSleeping)
+{
+	if (!Enemy)
+	{
+		return;
+	}
+
+	// Ticks, movement, animation and overlaps all off (and back on) together
+	Enemy->SetDormant(bSleeping);
+}
+
+void UCC_AIManager::OnWorldPreActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != GetWorld() || TickType == LEVELTICK_TimeOnly || TickType == LEVELTICK_PauseTick)
+	{
+		return;
+	}
+
+	if (ActiveEnemies.Num() > 0)
+	{
+		BatchUpdateAI();
+	}
+
+	UpdateProxies(DeltaSeconds);
+	UpdateSteering(DeltaSeconds);
+}
+
+void UCC_AIManager::UpdateProxies(float DeltaSeconds)
+{
+	if (ProxyStore.Num() == 0 && (!bUseEnemyProxies || GetTierCount(ECC_AILODTier::Sleeping) == 0))
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCC_AIManager::UpdateProxies);
+
+	ACC_PlayerCharacter* Player = GetPlayerCharacter();
+	if (!Player)
+	{
+		return;
+	}
+
+	const FCC_WorldWrap Wrap = GetWorldWrap();
+
+	// (1) Move every proxy in one column pass, flag the ones inside the actor radius
+	FCC_EnemyProxyStore::UpdateMovement(ProxyStore, Player->GetActorLocation(), Wrap,
+		bUseFlowField && FlowField.IsValid() ? &FlowField : nullptr, MaxAIRange, DeltaSeconds, ParallelMinBatchSize, GetParallelForFlags());
+
+	// (2) Proxies in range become actors - backwards, so a swap-remove only moves visited entries
+	int32 HydratedCount = 0;
+	for (int32 Index = ProxyStore.Num() - 1; Index >= 0 && HydratedCount < MaxHydrationsPerFrame; --Index)
+	{
+		if (ProxyStore.bInRange[Index] && HydrateProxy(Index))
+		{
+			++HydratedCount;
+		}
+	}
+
+	// (3) Sleeping actors become proxies (MaxAIRange + TierHysteresis out, so no ping-pong with (2))
+	int32 DehydratedCount = 0;
+	if (bUseEnemyProxies)
+	{
+		TArray<ACC_EnemyCharacter*, TInlineAllocator<32>> ToDehydrate;
+
+		const FCC_AITierBucket& Sleeping = GetTierBucket(ECC_AILODTier::Sleeping);
+		for (int32 Index = Sleeping.Num() - 1; Index >= 0 && ToDehydrate.Num() < MaxDehydrationsPerFrame; --Index)
+		{
+			ACC_EnemyCharacter* Enemy = Sleeping.Enemies[Index];
+			if (Enemy && Enemy->CanDehydrate())
+			{
+				ToDehydrate.Add(Enemy);
+			}
+		}
+
+		// Unregistering edits the bucket, so not while walking it
+		for (ACC_EnemyCharacter* Enemy : ToDehydrate)
+		{
+			DehydrateEnemy(Enemy);
+		}
+
+		DehydratedCount = ToDehydrate.Num();
+	}
+
+	INC_DWORD_STAT_BY(STAT_CC_AIHydrations, HydratedCount);
+	INC_DWORD_STAT_BY(STAT_CC_AIDehydrations, DehydratedCount);
+	SET_DWORD_STAT(STAT_CC_AIProxies, ProxyStore.Num());
+}
+
+ACC_EnemyCharacter* UCC_AIManager::HydrateProxy(int32 ProxyIndex)
+{
+	const FCC_EnemyProxyArchetype& Archetype = ProxyStore.GetArchetype(ProxyStore.Archetype[ProxyIndex]);
+	const FVector Location = ProxyStore.GetLocation(ProxyIndex);
+	const float Yaw = ProxyStore.Yaw[ProxyIndex];
+
+	UCC_EnemyPoolSubsystem* Pool = UCC_EnemyPoolSubsystem::Get(GetWorld());
+	ACC_EnemyCharacter* Enemy = Pool ? Pool->AcquireEnemy(Archetype.Class, Location, FRotator(0.0f, Yaw, 0.0f)) : nullptr;
+	if (!Enemy)
+	{
+		return nullptr;
+	}
+
+	Enemy->ApplyProxyHealth(ProxyStore.Health[ProxyIndex]);
+
+	if (ACC_EnemySpawner* Spawner = ProxyStore.Source[ProxyIndex].Get())
+	{
+		Spawner->AdoptEnemy(Enemy);
+	}
+
+	ProxyStore.RemoveAtSwap(ProxyIndex);
+	return Enemy;
+}
+
+void UCC_AIManager::DehydrateEnemy(ACC_EnemyCharacter* Enemy)
+{
+	UClass* EnemyClass = Enemy->GetClass();
+	ACC_EnemySpawner* Spawner = Enemy->GetSpawnSource();
+
+	// The spawner keeps counting it through the proxy
+	if (Spawner)
+	{
+		Spawner->ReleaseEnemy(Enemy);
+	}
+
+	ProxyStore.Add(ProxyStore.FindOrAddArchetype(EnemyClass), Enemy->GetActorLocation(), Enemy->GetActorRotation().Yaw,
+		Enemy->GetCurrentHealth(), Spawner);
+
+	// The actor waits in the pool for the next hydration or spawn
+	if (UCC_EnemyPoolSubsystem* Pool = UCC_EnemyPoolSubsystem::Get(GetWorld()))
+	{
+		Pool->ReleaseEnemy(Enemy);
+	}
+	else
+	{
+		Enemy->Destroy();
+	}
+}
+
+bool UCC_AIManager::SpawnEnemy(TSubclassOf<ACC_EnemyCharacter> EnemyClass, const FVector& Location, ACC_EnemySpawner* Source)
+{
+	if (!EnemyClass)
+	{
+		return false;
+	}
+
+	// Beyond the actor radius - no actor at all until the player comes close
+	const ACC_PlayerCharacter* Player = GetPlayerCharacter();
+	if (bUseEnemyProxies && Player && GetWorldWrap().DistSquared(Location, Player->GetActorLocation()) > MaxAIRange * MaxAIRange)
+	{
+		const int32 ArchetypeIndex = ProxyStore.FindOrAddArchetype(EnemyClass);
+		ProxyStore.Add(ArchetypeIndex, Location, 0.0f, ProxyStore.GetArchetype(ArchetypeIndex).MaxHealth, Source);
+		return true;
+	}
+
+	UCC_EnemyPoolSubsystem* Pool = UCC_EnemyPoolSubsystem::Get(GetWorld());
+	ACC_EnemyCharacter* Enemy = Pool ? Pool->AcquireEnemy(EnemyClass, Location, FRotator::ZeroRotator) : nullptr;
+	if (!Enemy)
+	{
+		return false;
+	}
+
+	if (Source)
+	{
+		Source->AdoptEnemy(Enemy);
+	}
+
+	return true;
+}
+
+FCC_WorldWrap UCC_AIManager::GetWorldWrap() const
+{
+	FCC_WorldWrap Wrap;
+	if (ACC_EnemyManager* EnemyManager = ACC_EnemyManager::Get(this))
+	{
+		Wrap = EnemyManager->GetWorldWrap();
 	}
+	return Wrap;
+}
+
+void UCC_AIManager::UpdateSteering(float DeltaSeconds)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCC_AIManager::UpdateSteering);
+	SCOPE_CYCLE_COUNTER(STAT_CC_AISteering);
+
+	LastSteeredCount = 0;
+
+	if (ActiveEnemies.Num() == 0)
+	{
+		return;
+	}
+
+	ACC_PlayerCharacter* Player = GetPlayerCharacter();
+	if (!Player)
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const FVector PlayerLocation = Player->GetActorLocation();
+
+	// Enemies chase the player's closest image when the tile grid wraps
+	FCC_WorldWrap Wrap;
+	if (ACC_EnemyManager* EnemyManager = ACC_EnemyManager::Get(this))
+	{
+		Wrap = EnemyManager->GetWorldWrap();
+	}
+
+	const float Alpha = RotationInterpSpeed > 0.0f ? FMath::Clamp(DeltaSeconds * RotationInterpSpeed, 0.0f, 1.0f) : 1.0f;
+
+	// Crowding only shows up close to the player - far enemies skip the neighbour walk
+	const FCC_AISeparationContext Separation = GetSeparationContext();
+
+	// Sleeping enemies are never visited
+	int32 SteeredCount = 0;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_CC_AISteeringNear);
+		SteeredCount += UpdateTierSteering(ECC_AILODTier::Near, PlayerLocation, Wrap, Separation, Alpha);
+	}
+	{
+		SCOPE_CYCLE_COUNTER(STAT_CC_AISteeringMid);
+		SteeredCount += UpdateTierSteering(ECC_AILODTier::Mid, PlayerLocation, Wrap, Separation, Alpha);
+	}
+	{
+		SCOPE_CYCLE_COUNTER(STAT_CC_AISteeringFar);
+		SteeredCount += UpdateTierSteering(ECC_AILODTier::Far, PlayerLocation, Wrap, FCC_AISeparationContext(), Alpha);
+	}
+
+	LastSteeredCount = SteeredCount;
+	INC_DWORD_STAT_BY(STAT_CC_AISteeredEnemies, SteeredCount);
+
+	// Lightweight enemies consume the input right away - one loop instead of one component tick each
+	UpdateLightweightMovement(DeltaSeconds);
+
+	LastSteeringTime = FPlatformTime::Seconds() - StartTime;
+}
+
+void UCC_AIManager::UpdateLightweightMovement(float DeltaSeconds)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCC_AIManager::UpdateLightweightMovement);
+	SCOPE_CYCLE_COUNTER(STAT_CC_AIMovement);
+
+	// Sleeping enemies are dormant, nothing to move
+	for (int32 TierIndex = 0; TierIndex < static_cast<int32>(ECC_AILODTier::Sleeping); ++TierIndex)
+	{
+		for (ACC_EnemyCharacter* Enemy : TierBuckets[TierIndex].Enemies)
+		{
+			UCC_EnemyMovementComponent* Movement = Enemy ? Cast<UCC_EnemyMovementComponent>(Enemy->GetCharacterMovement()) : nullptr;
+			if (Movement && Movement->IsLightweight())
+			{
+				Movement->UpdateLightweight(DeltaSeconds);
+			}
+		}
+	}
+}
+
+void UCC_AIManager::SetMovementManaged(ACC_EnemyCharacter* Enemy, bool bManaged)
+{
+	// Full CharacterMovement (bosses) keeps its own tick
+	UCC_EnemyMovementComponent* Movement = Cast<UCC_EnemyMovementComponent>(Enemy->GetCharacterMovement());
+	if (Movement && Movement->IsLightweight())
+	{
+		Movement->SetComponentTickEnabled(!bManaged);
+	}
+}
+
+int32 UCC_AIManager::UpdateTierSteering(ECC_AILODTier Tier, const FVector& PlayerLocation, const FCC_WorldWrap& Wrap,
+	const FCC_AISeparationContext& Separation, float Alpha)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FCC_AITierBucket& Bucket = GetTierBucket(Tier);
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	GatherSteeringInputs(Bucket, Now);
+	ComputeSteering(SteeringBatch, PlayerLocation, Wrap, bUseFlowField && FlowField.IsValid() ? &FlowField : nullptr,
+		Separation, Alpha, ParallelMinBatchSize, GetParallelForFlags());
+	const int32 SteeredCount = ApplySteering(Bucket, Now, GetTierUpdateInterval(Tier));
+
+	LastTierSteeringTime[static_cast<int32>(Tier)] = FPlatformTime::Seconds() - StartTime;
+
+	return SteeredCount;
+}
+
+void UCC_AIManager::GatherSteeringInputs(const FCC_AITierBucket& Bucket, double Now)
+{
+	SteeringBatch.Reset();
+
+	for (int32 Index = 0; Index < Bucket.Num(); ++Index)
+	{
+		ACC_EnemyCharacter* Enemy = Bucket.Enemies[Index];
+
+		// Same conditions as ACC_EnemyCharacter::Tick
+		if (!Enemy || !Enemy->GetChasePlayer() || !Enemy->IsAlive() || Enemy->IsAttacking())
+		{
+			continue;
+		}
+
+		const FVector Location = Enemy->GetActorLocation();
+		const float DetectionRange = Enemy->GetDetectionRange();
+		const FCC_AISteeringCache& Cache = Bucket.Steering[Index];
+
+		SteeringBatch.EnemyIndex.Add(Index);
+		SteeringBatch.Actor.Add(Enemy);
+		SteeringBatch.X.Add(Location.X);
+		SteeringBatch.Y.Add(Location.Y);
+		SteeringBatch.Z.Add(Location.Z);
+		SteeringBatch.Yaw.Add(Enemy->GetActorRotation().Yaw);
+		SteeringBatch.DetectionRangeSq.Add(DetectionRange * DetectionRange);
+
+		SteeringBatch.bSolve.Add(Now >= Cache.NextSolveTime ? 1 : 0);
+		SteeringBatch.DirX.Add(Cache.DirX);
+		SteeringBatch.DirY.Add(Cache.DirY);
+		SteeringBatch.TargetYaw.Add(Cache.TargetYaw);
+		SteeringBatch.bMove.Add(Cache.bMove ? 1 : 0);
+	}
+
+	SteeringBatch.NewYaw.SetNumUninitialized(SteeringBatch.Num());
+}
+
+void UCC_AIManager::ComputeSteering(FCC_AISteeringBatch& Batch, const FVector& PlayerLocation,
+	const FCC_WorldWrap& Wrap, const FCC_FlowField* FlowField, const FCC_AISeparationContext& Separation,
+	float Alpha, int32 MinBatchSize, EParallelForFlags Flags)
+{
+	const bool bSeparate = Separation.IsEnabled();
+
+	ParallelFor(TEXT("CC_AISteering"), Batch.Num(), MinBatchSize, [&Batch, &PlayerLocation, &Wrap, FlowField, &Separation, bSeparate, Alpha](int32 i)
+	{
+		if (Batch.bSolve[i])
+		{
+			const FVector Delta = Wrap.MinimumImageDelta(FVector(Batch.X[i], Batch.Y[i], Batch.Z[i]), PlayerLocation);
+			const float PlanarSq = Delta.X * Delta.X + Delta.Y * Delta.Y;
+			const float DistSq = PlanarSq + Delta.Z * Delta.Z;
+
+			// Outside detection range (or standing on the player) - no input, keep facing
+			if (DistSq > Batch.DetectionRangeSq[i] || PlanarSq <= KINDA_SMALL_NUMBER)
+			{
+				Batch.bMove[i] = 0;
+				Batch.DirX[i] = 0.0f;
+				Batch.DirY[i] = 0.0f;
+				Batch.TargetYaw[i] = Batch.Yaw[i];
+			}
+			else
+			{
+				// Walking movement drops Z anyway, so steer in the plane
+				// (around walls via the flow field, straight when nothing is in the way)
+				FVector2D Direction;
+				if (!FlowField || !FlowField->SampleDirection(FVector(Batch.X[i], Batch.Y[i], Batch.Z[i]), Direction))
+				{
+					const float InvLength = FMath::InvSqrt(PlanarSq);
+					Direction = FVector2D(Delta.X * InvLength, Delta.Y * InvLength);
+				}
+
+				// Spread out instead of stacking up (pursuit wins again once the push cancels it out)
+				if (bSeparate)
+				{
+					const FVector2D Separated = Direction + ComputeSeparation(Separation, Batch.Actor[i], Batch.X[i], Batch.Y[i]) * Separation.Weight;
+					if (!Separated.IsNearlyZero())
+					{
+						Direction = Separated.GetSafeNormal();
+					}
+				}
+
+				Batch.bMove[i] = 1;
+				Batch.DirX[i] = Direction.X;
+				Batch.DirY[i] = Direction.Y;
+				Batch.TargetYaw[i] = FMath::RadiansToDegrees(FMath::Atan2(Direction.Y, Direction.X));
+			}
+		}
+
+		// Facing keeps interpolating every frame, also between re-solves (shortest way round)
+		const float DeltaYaw = Batch.bMove[i] ? FRotator::NormalizeAxis(Batch.TargetYaw[i] - Batch.Yaw[i]) : 0.0f;
+		Batch.NewYaw[i] = Batch.Yaw[i] + DeltaYaw * Alpha;
+	}, Flags);
+}
+
+FVector2D UCC_AIManager::ComputeSeparation(const FCC_AISeparationContext& Separation, const AActor* Self, float X, float Y)
+{
+	const FCC_EnemySnapshot& Snapshot = *Separation.Snapshot;
+	const float Radius = Separation.Radius;
+	const float RadiusSq = Radius * Radius;
+	const float InvRadius = 1.0f / Radius;
+
+	FVector2D Push = FVector2D::ZeroVector;
+	int32 NeighbourCount = 0;
+
+	// Plain (unwrapped) cell walk - enemies on the far side of a seam don't push, which only matters for a frame or two
+	Separation.Hash->ForEachCellInRect(FVector2D(X - Radius, Y - Radius), FVector2D(X + Radius, Y + Radius),
+		[&](const FIntPoint& Cell, int32 StartEntry, int32 EndEntry)
+		{
+			for (int32 Entry = StartEntry; Entry < EndEntry && NeighbourCount < Separation.MaxNeighbours; ++Entry)
+			{
+				const AActor* Other = Snapshot.Actors[Entry];
+				if (!Snapshot.Alive[Entry] || Other == Self)
+				{
+					continue;
+				}
+
+				const float DX = X - Snapshot.X[Entry];
+				const float DY = Y - Snapshot.Y[Entry];
+				const float DistSq = DX * DX + DY * DY;
+
+				if (DistSq >= RadiusSq)
+				{
+					continue;
+				}
+
+				// Exact overlap (spawned on the same point) - no direction to push along, so each pair gets its
+				// own axis from the two identities and the two enemies take opposite ends of it, full strength
+				if (DistSq <= KINDA_SMALL_NUMBER)
+				{
+					const UPTRINT SelfId = reinterpret_cast<UPTRINT>(Self);
+					const UPTRINT OtherId = reinterpret_cast<UPTRINT>(Other);
+					const uint32 PairHash = HashCombineFast(GetTypeHash(FMath::Min(SelfId, OtherId)), GetTypeHash(FMath::Max(SelfId, OtherId)));
+					const float Angle = static_cast<float>(PairHash & 0xFFFF) * (UE_TWO_PI / 65536.0f);
+					const float Sign = SelfId < OtherId ? 1.0f : -1.0f;
+
+					Push.X += FMath::Cos(Angle) * Sign;
+					Push.Y += FMath::Sin(Angle) * Sign;
+					++NeighbourCount;
+					continue;
+				}
+
+				// Linear falloff: full push when touching, none at the radius
+				const float InvDist = FMath::InvSqrt(DistSq);
+				const float Falloff = 1.0f - DistSq * InvDist * InvRadius;
+				Push.X += DX * InvDist * Falloff;
+				Push.Y += DY * InvDist * Falloff;
+				++NeighbourCount;
+			}
+		});
+
+	return Push;
+}
+
+FCC_AISeparationContext UCC_AIManager::GetSeparationContext() const
+{
+	FCC_AISeparationContext Separation;
+	if (!bCrowdSeparation)
+	{
+		return Separation;
+	}
+
+	// Hash and snapshot are rebuilt after actor tick - reading them here (before actor tick) gives last frame's positions
+	if (ACC_EnemyManager* EnemyManager = ACC_EnemyManager::Get(this))
+	{
+		Separation.Hash = &EnemyManager->GetSpatialHash();
+		Separation.Snapshot = &EnemyManager->GetEnemySnapshot();
+		Separation.Radius = SeparationRadius;
+		Separation.Weight = SeparationWeight;
+		Separation.MaxNeighbours = SeparationMaxNeighbours;
+	}
+
+	return Separation;
+}
+
+void UCC_AIManager::SetCrowdSeparationEnabled(bool bEnabled)
+{
+	if (bCrowdSeparation == bEnabled)
+	{
+		return;
+	}
+
+	bCrowdSeparation = bEnabled;
+
+	if (const UCC_EnemyRegistry* Registry = UCC_EnemyRegistry::Get(this))
+	{
+		for (const FCC_EnemyHandle& Handle : ActiveEnemies)
+		{
+			if (ACC_EnemyCharacter* Enemy = Registry->Resolve(Handle))
+			{
+				ApplyCrowdCollision(Enemy);
+			}
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("AI Manager crowd separation %s (%d enemies)"), bEnabled ? TEXT("on") : TEXT("off"), ActiveEnemies.Num());
+}
+
+void UCC_AIManager::ApplyCrowdCollision(ACC_EnemyCharacter* Enemy) const
+{
+	if (Enemy)
+	{
+		Enemy->SetIgnoreEnemyCollision(bCrowdSeparation);
+	}
+}
+
+int32 UCC_AIManager::ApplySteering(FCC_AITierBucket& Bucket, double Now, float UpdateInterval)
+{
+	int32 SteeredCount = 0;
+	int32 SolveCount = 0;
+
+	for (int32 i = 0; i < SteeringBatch.Num(); ++i)
+	{
+		const int32 Index = SteeringBatch.EnemyIndex[i];
+
+		if (SteeringBatch.bSolve[i])
+		{
+			FCC_AISteeringCache& Cache = Bucket.Steering[Index];
+			Cache.DirX = SteeringBatch.DirX[i];
+			Cache.DirY = SteeringBatch.DirY[i];
+			Cache.TargetYaw = SteeringBatch.TargetYaw[i];
+			Cache.bMove = SteeringBatch.bMove[i] != 0;
+			Cache.NextSolveTime = Now + UpdateInterval;
+			++SolveCount;
+		}
+
+		if (!SteeringBatch.bMove[i])
+		{
+			continue;
+		}
+
+		ACC_EnemyCharacter* Enemy = Bucket.Enemies[Index];
+
+		Enemy->AddMovementInput(FVector(SteeringBatch.DirX[i], SteeringBatch.DirY[i], 0.0f), 1.0f);
+
+		// Skip the component update once the enemy already faces the player
+		if (!FMath::IsNearlyEqual(SteeringBatch.NewYaw[i], SteeringBatch.Yaw[i], KINDA_SMALL_NUMBER))
+		{
+			Enemy->SetActorRotation(FRotator(0.0f, SteeringBatch.NewYaw[i], 0.0f));
+		}
+
+		++SteeredCount;
+	}
+
+	INC_DWORD_STAT_BY(STAT_CC_AISteeringSolves, SolveCount);
+
+	return SteeredCount;
+}
+
+void UCC_AIManager::UpdateFlowField(const FVector& PlayerLocation, const FCC_WorldWrap& Wrap)
+{
+	// The field lives on the wrap domain - without one enemies steer straight
+	if (!bUseFlowField || !Wrap.IsEnabled())
+	{
+		FlowField.Reset();
+		return;
+	}
+
+	if (!FlowField.Matches(Wrap.Center, Wrap.Period, FlowFieldCellSize, true))
+	{
+		FlowField.Initialize(Wrap.Center, Wrap.Period, FlowFieldCellSize, true);
+	}
+
+	// No-op unless the player changed cell, and cheap while the field has no walls
+	FlowField.Update(PlayerLocation);
 }
 
 ACC_PlayerCharacter* UCC_AIManager::GetPlayerCharacter() const
@@ -173,24 +1107,15 @@ ACC_PlayerCharacter* UCC_AIManager::GetPlayerCharacter() const
 	return nullptr;
 }
 
-void UCC_AIManager::UpdateEnemyAIState(ACC_EnemyCharacter* Enemy, const FVector& PlayerLocation)
+void UCC_AIManager::UpdateEnemyAIState(ACC_EnemyCharacter* Enemy, bool bChase)
 {
 	if (!Enemy)
 	{
 		return;
 	}
 
-	FVector EnemyLocation = Enemy->GetActorLocation();
-
-	// PERFORMANCE: Use DistSquared to avoid sqrt calculation
-	float DistanceSquared = FVector::DistSquared(EnemyLocation, PlayerLocation);
-
-	// Use individual enemy's DetectionRange (respects existing design)
-	float DetectionRange = Enemy->GetDetectionRange();
-	float DetectionRangeSquared = DetectionRange * DetectionRange;
-
 	// Check if enemy should chase based on its own detection range
-	if (DistanceSquared <= DetectionRangeSquared)
+	if (bChase)
 	{
 		// Enemy should chase - set the existing bChasePlayer flag
 		Enemy->SetChasePlayer(true);
@@ -200,21 +1125,10 @@ void UCC_AIManager::UpdateEnemyAIState(ACC_EnemyCharacter* Enemy, const FVector&
 	{
 		// Enemy too far or outside its detection range
 		Enemy->SetChasePlayer(false);
-
-		// Additional check: if way too far, put to sleep for performance
-		float MaxAIRangeSquared = MaxAIRange * MaxAIRange;
-		if (DistanceSquared > MaxAIRangeSquared)
-		{
-			SleepingEnemies.Add(Enemy);
-		}
+		ActiveAIEnemies.Remove(Enemy);
 	}
 }
 
-bool UCC_AIManager::IsEnemyInAIRange(const FVector& EnemyLocation, const FVector& PlayerLocation) const
-{
-	return false;
-}
-
 UCC_AIManager* UCC_AIManager::Get(const UObject* WorldContextObject)
 {
 	if (UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject))
@@ -226,4 +1140,3 @@ UCC_AIManager* UCC_AIManager::Get(const UObject* WorldContextObject)
 	}
 	return nullptr;
 }
-
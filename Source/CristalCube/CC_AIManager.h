@@ -4,8 +4,206 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Async/ParallelFor.h"
+#include "CC_FlowField.h"
+#include "CC_EnemyProxyStore.h"
+#include "CC_EnemyRegistry.h"
 #include "CC_AIManager.generated.h"
 
+class ACC_EnemyCharacter;
+struct FCC_WorldWrap;
+struct FCC_EnemySnapshot;
+class FCC_EnemySpatialHash;
+
+/**
+ * AI level of detail by distance to the player
+ * Near steers every frame, Mid and Far re-solve at a reduced rate and keep moving along
+ * the last solution in between, Sleeping enemies are dormant (ACC_EnemyCharacter::SetDormant).
+ */
+UENUM(BlueprintType)
+enum class ECC_AILODTier : uint8
+{
+	Near        UMETA(DisplayName = "Near"),
+	Mid         UMETA(DisplayName = "Mid"),
+	Far         UMETA(DisplayName = "Far"),
+	Sleeping    UMETA(DisplayName = "Sleeping"),
+
+	Count       UMETA(Hidden)
+};
+
+// Last steering solution of one enemy (reused until the next re-solve) and its decision schedule
+struct FCC_AISteeringCache
+{
+	float DirX = 0.0f;
+	float DirY = 0.0f;
+	float TargetYaw = 0.0f;
+	bool bMove = false;
+
+	// World time of the next re-solve (staggered so a tier doesn't solve in one frame)
+	double NextSolveTime = 0.0;
+
+	// Decision pass: due again at this world time, forced once GFrameCounter is MaxDecisionStaleFrames past the last one
+	double NextDecisionTime = 0.0;
+	uint64 LastDecisionFrame = 0;
+};
+
+// Enemies of one LOD tier, with their steering cache at the same index
+USTRUCT()
+struct FCC_AITierBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<ACC_EnemyCharacter*> Enemies;
+
+	TArray<FCC_AISteeringCache> Steering;
+
+	ECC_AILODTier Tier = ECC_AILODTier::Near;
+
+	int32 Num() const { return Enemies.Num(); }
+
+	// Both keep the enemies' FCC_AIRegistrySlot in step (the swapped-in enemy gets its new index)
+	void Add(ACC_EnemyCharacter* Enemy, const FCC_AISteeringCache& Cache);
+	void RemoveAtSwap(int32 Index);
+
+	void Empty()
+	{
+		Enemies.Empty();
+		Steering.Empty();
+	}
+};
+
+/**
+ * Structure-of-arrays steering state for one tier's chasing enemies, rebuilt each frame
+ * Gathered from the actors once, solved in a single loop, then written back.
+ */
+struct FCC_AISteeringBatch
+{
+	// Index into the tier bucket
+	TArray<int32> EnemyIndex;
+
+	// Compared against the snapshot only (never dereferenced off the game thread)
+	TArray<const AActor*> Actor;
+
+	// Inputs
+	TArray<float> X;
+	TArray<float> Y;
+	TArray<float> Z;
+	TArray<float> Yaw;
+	TArray<float> DetectionRangeSq;
+
+	// 1 = re-solve this frame, 0 = keep the cached direction / target yaw below
+	TArray<uint8> bSolve;
+
+	// Solution (prefilled from the cache when not solving, 1 = add movement input)
+	TArray<float> DirX;
+	TArray<float> DirY;
+	TArray<float> TargetYaw;
+	TArray<uint8> bMove;
+
+	// Output
+	TArray<float> NewYaw;
+
+	int32 Num() const { return EnemyIndex.Num(); }
+
+	void Reset()
+	{
+		EnemyIndex.Reset();
+		Actor.Reset();
+		X.Reset();
+		Y.Reset();
+		Z.Reset();
+		Yaw.Reset();
+		DetectionRangeSq.Reset();
+		bSolve.Reset();
+		DirX.Reset();
+		DirY.Reset();
+		TargetYaw.Reset();
+		bMove.Reset();
+		NewYaw.Reset();
+	}
+};
+
+/**
+ * Neighbour push for the steering pass (boids separation)
+ * Reads last frame's enemy positions from the enemy manager's spatial hash, so enemies can stop
+ * blocking each other's capsules and still spread out instead of stacking on the player.
+ */
+struct FCC_AISeparationContext
+{
+	// Null = separation off
+	const FCC_EnemySpatialHash* Hash = nullptr;
+	const FCC_EnemySnapshot* Snapshot = nullptr;
+
+	float Radius = 0.0f;
+	float Weight = 0.0f;
+
+	// At most this many neighbours push (caps the cost inside a dense crowd)
+	int32 MaxNeighbours = 0;
+
+	bool IsEnabled() const { return Hash != nullptr && Snapshot != nullptr && Radius > 0.0f && Weight > 0.0f; }
+};
+
+// Copy of the LOD settings handed to worker threads (no UObject reads off the game thread)
+struct FCC_AILODSettings
+{
+	// Outer edge of Near, Mid, Far - beyond the last one enemies sleep
+	float TierRanges[3] = {};
+	float TierHysteresis = 0.0f;
+};
+
+/**
+ * Structure-of-arrays input / output of the LOD decision pass (BatchUpdateAI)
+ * Gathered on the game thread, evaluated in ParallelFor without touching actors,
+ * applied on the game thread in gather order.
+ */
+struct FCC_AIDecisionBatch
+{
+	// Where the enemy lives (bucket + index at gather time)
+	TArray<uint8> Tier;
+	TArray<int32> EnemyIndex;
+
+	// Inputs
+	TArray<float> X;
+	TArray<float> Y;
+	TArray<float> Z;
+	TArray<float> DetectionRangeSq;
+
+	// Outputs
+	TArray<uint8> NewTier;
+	TArray<uint8> bChase;
+
+	int32 Num() const { return EnemyIndex.Num(); }
+
+	void Reset()
+	{
+		Tier.Reset();
+		EnemyIndex.Reset();
+		X.Reset();
+		Y.Reset();
+		Z.Reset();
+		DetectionRangeSq.Reset();
+		NewTier.Reset();
+		bChase.Reset();
+	}
+
+	// Size the outputs to match the gathered inputs
+	void SetOutputNum()
+	{
+		const int32 NewNum = Num();
+		NewTier.SetNumUninitialized(NewNum);
+		bChase.SetNumUninitialized(NewNum);
+	}
+};
+
+// Tier change found by ApplyDecisions, applied once the whole slice is written back
+struct FCC_AITierMove
+{
+	ECC_AILODTier FromTier = ECC_AILODTier::Near;
+	int32 Index = INDEX_NONE;
+	ECC_AILODTier ToTier = ECC_AILODTier::Near;
+};
+
 
 /**
  * Centralized AI Management System for Enemy Characters
@@ -39,42 +237,240 @@ public:
 	UFUNCTION(BlueprintPure, Category = "AI Manager")
 	int32 GetActiveAICount() const { return ActiveAIEnemies.Num(); }
 
+	UFUNCTION(BlueprintPure, Category = "AI Manager")
+	int32 GetSteeredEnemyCount() const { return LastSteeredCount; }
+
+	// LOD tier sizes and last frame's steering time per tier
+	UFUNCTION(BlueprintPure, Category = "AI Manager")
+	int32 GetTierCount(ECC_AILODTier Tier) const;
+
+	UFUNCTION(BlueprintPure, Category = "AI Manager")
+	float GetTierSteeringTimeMs(ECC_AILODTier Tier) const;
+
+	// Frames whose decision slice went past AIDecisionBudgetMs (stale enemies go over it, up to MaxStaleDecisionsPerFrame)
+	UFUNCTION(BlueprintPure, Category = "AI Manager")
+	int32 GetBudgetOverrunCount() const { return BudgetOverrunCount; }
+
+	const FCC_FlowField& GetFlowField() const { return FlowField; }
+
+	/**
+	 * Spawn into whichever representation fits: an actor within MaxAIRange of the player
+	 * (pooled when one is free), a proxy beyond it. Proxies become actors once the player gets close.
+	 * @param Source - spawner that counts the enemy (adopts the actor, or owns the proxy)
+	 * @return true if an actor or proxy was created
+	 */
+	bool SpawnEnemy(TSubclassOf<ACC_EnemyCharacter> EnemyClass, const FVector& Location, class ACC_EnemySpawner* Source = nullptr);
+
+	UFUNCTION(BlueprintPure, Category = "AI Manager")
+	int32 GetProxyCount() const { return ProxyStore.Num(); }
+
+	const FCC_EnemyProxyStore& GetProxyStore() const { return ProxyStore; }
+
+	/**
+	 * Crowd separation A/B switch
+	 * On: enemy capsules use the Enemy object channel and ignore each other, the steering pass spreads them out.
+	 * Off: enemy capsules block each other as Pawns (old behaviour), no separation force.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AI Manager")
+	void SetCrowdSeparationEnabled(bool bEnabled);
+
+	UFUNCTION(BlueprintPure, Category = "AI Manager")
+	bool IsCrowdSeparationEnabled() const { return bCrowdSeparation; }
+
 protected:
-	// Core AI Processing
-	UFUNCTION()
+	// Core AI Processing - one time-sliced decision pass per frame
 	void BatchUpdateAI();
 
 	// Helper Functions
 	class ACC_PlayerCharacter* GetPlayerCharacter() const;
-	void UpdateEnemyAIState(ACC_EnemyCharacter* Enemy, const FVector& PlayerLocation);
-	bool IsEnemyInAIRange(const FVector& EnemyLocation, const FVector& PlayerLocation) const;
+	void UpdateEnemyAIState(ACC_EnemyCharacter* Enemy, bool bChase);
+
+	// Decision phases of BatchUpdateAI: gather (game thread) -> evaluate (ParallelFor) -> apply (game thread)
+	// Stale: enemies MaxDecisionStaleFrames past their last decision, found by a cursor that sweeps the tiers in
+	// slices (drops destroyed entries on the way), at most MaxStaleDecisionsPerFrame - the rest is counted as deferred
+	int32 GatherStaleDecisions(uint64 Frame, int32& OutDeferredCount);
+	// Due: round-robin per tier, near tier first, at most MaxCount
+	int32 GatherDueDecisions(double Now, uint64 Frame, int32 MaxCount);
+	void AddDecisionInput(int32 TierIndex, int32 Index, const ACC_EnemyCharacter* Enemy);
+	static void EvaluateDecisions(FCC_AIDecisionBatch& Batch, const FVector& PlayerLocation, const FCC_WorldWrap& Wrap,
+		const FCC_AILODSettings& Settings, int32 MinBatchSize, EParallelForFlags Flags);
+	int32 ApplyDecisions(double Now, uint64 Frame);
+
+	// LOD
+	FCC_AILODSettings GetLODSettings() const;
+	static ECC_AILODTier GetLODTier(const FCC_AILODSettings& Settings, float DistanceSquared, ECC_AILODTier CurrentTier);
+	float GetTierUpdateInterval(ECC_AILODTier Tier) const;
+	void MoveToTier(ECC_AILODTier FromTier, int32 Index, ECC_AILODTier ToTier);
+	void SetEnemySleeping(ACC_EnemyCharacter* Enemy, bool bSleeping);
+	FCC_AITierBucket& GetTierBucket(ECC_AILODTier Tier) { return TierBuckets[static_cast<int32>(Tier)]; }
+
+	// Steering (every frame, before movement components tick)
+	void OnWorldPreActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	// Level travel: forget the old world's enemies, proxies and flow field
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+	void ResetWorldState();
+	void UpdateSteering(float DeltaSeconds);
+	int32 UpdateTierSteering(ECC_AILODTier Tier, const FVector& PlayerLocation, const FCC_WorldWrap& Wrap,
+		const FCC_AISeparationContext& Separation, float Alpha);
+	void GatherSteeringInputs(const FCC_AITierBucket& Bucket, double Now);
+	int32 ApplySteering(FCC_AITierBucket& Bucket, double Now, float UpdateInterval);
+
+	// Lightweight enemy movement, driven from here instead of per-component ticks
+	void UpdateLightweightMovement(float DeltaSeconds);
+	void SetMovementManaged(ACC_EnemyCharacter* Enemy, bool bManaged);
+
+	// Pure math over the batch - no actor access, safe to run in ParallelFor
+	static void ComputeSteering(FCC_AISteeringBatch& Batch, const FVector& PlayerLocation,
+		const FCC_WorldWrap& Wrap, const FCC_FlowField* FlowField, const FCC_AISeparationContext& Separation,
+		float Alpha, int32 MinBatchSize, EParallelForFlags Flags);
+
+	// Sum of pushes away from neighbours inside Separation.Radius (zero when alone)
+	// Self is skipped by identity, exactly co-located neighbours push along a per-pair fallback axis
+	static FVector2D ComputeSeparation(const FCC_AISeparationContext& Separation, const AActor* Self, float X, float Y);
+
+	// Separation inputs for this frame (disabled context when separation is off)
+	FCC_AISeparationContext GetSeparationContext() const;
+
+	// Capsule channel setup matching bCrowdSeparation
+	void ApplyCrowdCollision(ACC_EnemyCharacter* Enemy) const;
+
+	// Keep the pursuit field on the wrap domain and pointed at the player (AI tick)
+	void UpdateFlowField(const FVector& PlayerLocation, const FCC_WorldWrap& Wrap);
+
+	// Proxies: move (column pass), hydrate the ones in range, dehydrate sleeping actors
+	void UpdateProxies(float DeltaSeconds);
+	ACC_EnemyCharacter* HydrateProxy(int32 ProxyIndex);
+	void DehydrateEnemy(ACC_EnemyCharacter* Enemy);
+
+	FCC_WorldWrap GetWorldWrap() const;
+
+	EParallelForFlags GetParallelForFlags() const;
 
 protected:
 
 	// Enemy Collections
-	UPROPERTY()
-	TArray<ACC_EnemyCharacter*> ActiveEnemies;
+	// Registered enemies by UCC_EnemyRegistry handle (the tier buckets hold the actors the batches read)
+	FCC_EnemyHandleSet ActiveEnemies;
 
 	UPROPERTY()
-	TArray<ACC_EnemyCharacter*> ActiveAIEnemies;  // Currently processing AI
+	TSet<ACC_EnemyCharacter*> ActiveAIEnemies;  // Currently chasing (kept per decision, slices don't rebuild it)
 
+	// One bucket per ECC_AILODTier - SleepingEnemies are GetTierBucket(Sleeping)
 	UPROPERTY()
-	TArray<ACC_EnemyCharacter*> SleepingEnemies;  // Too far, sleeping
+	TArray<FCC_AITierBucket> TierBuckets;
 
-	// Timer Management
-	UPROPERTY()
-	FTimerHandle AIBatchUpdateTimer;
+	FDelegateHandle PreActorTickHandle;
+	FDelegateHandle WorldCleanupHandle;
+
+	// Round-robin position of the decision slice, per ECC_AILODTier
+	int32 DecisionCursors[static_cast<int32>(ECC_AILODTier::Count)] = {};
+
+	// Position of the stale sweep (tier, index in its bucket)
+	int32 StaleScanTier = 0;
+	int32 StaleScanIndex = 0;
+
+	// Reused every frame
+	FCC_AISteeringBatch SteeringBatch;
+	FCC_AIDecisionBatch DecisionBatch;
+	TArray<FCC_AITierMove> PendingTierMoves;
+
+	// Shared by every enemy, covers the wrap domain (the active 3x3 tile area)
+	FCC_FlowField FlowField;
+
+	// Enemies without an actor (their actors go back to UCC_EnemyPoolSubsystem)
+	FCC_EnemyProxyStore ProxyStore;
 
 	// Configuration
+	// Each enemy re-decides (chase / attack / tier) this often - spread over frames by the budget below
 	UPROPERTY(EditAnywhere, Category = "AI Settings", meta = (ClampMin = "0.05", ClampMax = "1.0"))
 	float AIUpdateFrequency = 0.1f;  // 10 updates per second
 
+	// Game thread time per frame for the decision pass, near tier first
+	UPROPERTY(EditAnywhere, Category = "AI Settings", meta = (ClampMin = "0.0"))
+	float AIDecisionBudgetMs = 0.5f;
+
+	UPROPERTY(EditAnywhere, Category = "AI Settings", meta = (ClampMin = "1"))
+	int32 MaxDecisionsPerFrame = 256;
+
+	// Budget is checked between chunks of this many enemies
+	UPROPERTY(EditAnywhere, Category = "AI Settings", meta = (ClampMin = "1"))
+	int32 DecisionChunkSize = 32;
+
+	// Enemies this far past their last decision are processed even over budget
+	// (found by a sweep that covers everyone every half of this, so the wait stays around 1.5x)
+	UPROPERTY(EditAnywhere, Category = "AI Settings", meta = (ClampMin = "1"))
+	int32 MaxDecisionStaleFrames = 30;
+
+	// Forced stale decisions per frame - more than this are left for the next frames
+	UPROPERTY(EditAnywhere, Category = "AI Settings", meta = (ClampMin = "1"))
+	int32 MaxStaleDecisionsPerFrame = 64;
+
 	UPROPERTY(EditAnywhere, Category = "AI Settings")
 	float MaxAIRange = 3000.0f;  // 30m - beyond this, enemies sleep
 
 	UPROPERTY(EditAnywhere, Category = "AI Settings")
 	float HighPriorityRange = 1500.0f;  // 15m - high priority enemies
 
+	UPROPERTY(EditAnywhere, Category = "AI Settings")
+	float MidPriorityRange = 2250.0f;  // 22.5m - beyond this, far tier
+
+	// An enemy only drops to a farther tier once this far past the boundary (no flicker on the edge)
+	UPROPERTY(EditAnywhere, Category = "AI Settings", meta = (ClampMin = "0.0"))
+	float TierHysteresis = 150.0f;
+
+	// Steering re-solve interval per tier (near tier solves every frame)
+	UPROPERTY(EditAnywhere, Category = "AI Settings", meta = (ClampMin = "0.0"))
+	float MidUpdateInterval = 0.2f;
+
+	UPROPERTY(EditAnywhere, Category = "AI Settings", meta = (ClampMin = "0.0"))
+	float FarUpdateInterval = 1.0f;
+
+	// Run the decision / steering math on worker threads
+	UPROPERTY(EditAnywhere, Category = "AI Settings")
+	bool bParallelAI = true;
+
+	// Enemies per ParallelFor task (smaller batches aren't worth the task overhead)
+	UPROPERTY(EditAnywhere, Category = "AI Settings", meta = (ClampMin = "1"))
+	int32 ParallelMinBatchSize = 64;
+
+	// Steer along the shared flow field instead of straight at the player
+	UPROPERTY(EditAnywhere, Category = "AI Settings")
+	bool bUseFlowField = true;
+
+	UPROPERTY(EditAnywhere, Category = "AI Settings", meta = (ClampMin = "50.0"))
+	float FlowFieldCellSize = 200.0f;
+
+	// Enemies pass through each other and separate in the steering pass instead of blocking capsules
+	UPROPERTY(EditAnywhere, Category = "AI Settings")
+	bool bCrowdSeparation = true;
+
+	// Neighbours closer than this push the enemy away (about two capsule radii)
+	UPROPERTY(EditAnywhere, Category = "AI Settings", meta = (ClampMin = "0.0"))
+	float SeparationRadius = 120.0f;
+
+	// Push strength relative to the pursuit direction (1 = equal weight at full overlap)
+	UPROPERTY(EditAnywhere, Category = "AI Settings", meta = (ClampMin = "0.0"))
+	float SeparationWeight = 1.5f;
+
+	UPROPERTY(EditAnywhere, Category = "AI Settings", meta = (ClampMin = "1"))
+	int32 SeparationMaxNeighbours = 8;
+
+	// Sleeping-tier enemies become proxies, proxies within MaxAIRange become actors again
+	UPROPERTY(EditAnywhere, Category = "AI Settings")
+	bool bUseEnemyProxies = true;
+
+	// Caps so a wave crossing the radius is spread over frames
+	UPROPERTY(EditAnywhere, Category = "AI Settings", meta = (ClampMin = "1"))
+	int32 MaxHydrationsPerFrame = 16;
+
+	UPROPERTY(EditAnywhere, Category = "AI Settings", meta = (ClampMin = "1"))
+	int32 MaxDehydrationsPerFrame = 32;
+
+	// Facing interpolation speed (same as the old per-enemy RInterpTo)
+	UPROPERTY(EditAnywhere, Category = "AI Settings", meta = (ClampMin = "0.0"))
+	float RotationInterpSpeed = 5.0f;
+
 	// Performance Tracking
 	UPROPERTY(VisibleAnywhere, Category = "Debug")
 	float LastUpdateTime = 0.0f;
@@ -82,6 +478,18 @@ protected:
 	UPROPERTY(VisibleAnywhere, Category = "Debug")
 	int32 LastProcessedCount = 0;
 
+	UPROPERTY(VisibleAnywhere, Category = "Debug")
+	int32 BudgetOverrunCount = 0;
+
+	UPROPERTY(VisibleAnywhere, Category = "Debug")
+	float LastSteeringTime = 0.0f;
+
+	UPROPERTY(VisibleAnywhere, Category = "Debug")
+	int32 LastSteeredCount = 0;
+
+	// Seconds, indexed by ECC_AILODTier
+	float LastTierSteeringTime[static_cast<int32>(ECC_AILODTier::Count)] = {};
+
 public:
 	// Static Access (for convenience)
 	UFUNCTION(BlueprintPure, Category = "AI Manager", meta = (WorldContext = "WorldContextObject"))
@@ -326,7 +326,7 @@ void ACC_CubeWorldManager::PrintDebugInfo()
 
 	if (ActiveCube)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Active Cube Actors: %d"), ActiveCube->ManagedActors.Num());
+		UE_LOG(LogTemp, Warning, TEXT("Active Cube Actors: %d (Enemies: %d)"), ActiveCube->ManagedActors.Num(), ActiveCube->ManagedEnemies.Num());
 	}
 
 	UE_LOG(LogTemp, Warning, TEXT("=============================================="));
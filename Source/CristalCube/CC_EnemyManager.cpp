@@ -2,8 +2,13 @@
 
 
 #include "CC_EnemyManager.h"
+#include "CC_Stats.h"
+#include "CC_AIManager.h"
+#include "Characters/CC_Character.h"
+#include "Characters/CC_EnemyCharacter.h"
 #include "Kismet/GameplayStatics.h"
 #include "EngineUtils.h"
+#include "Engine/World.h"
 
 ACC_EnemyManager* ACC_EnemyManager::Instance = nullptr;
 
@@ -22,10 +27,29 @@ void ACC_EnemyManager::BeginPlay()
 
 	Instance = this;
 
-	UE_LOG(LogTemp, Log, TEXT("[ENEMY MANAGER] Initialized"));
+	SpatialHash.SetCellSize(SpatialCellSize);
+
+	// Grid rebuild + batched queries run after every tick group and the timer manager (weapon timers)
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &ACC_EnemyManager::OnWorldPostActorTick);
+
+	UE_LOG(LogTemp, Log, TEXT("[ENEMY MANAGER] Initialized (Cell size: %.0f)"), SpatialCellSize);
 	
 }
 
+void ACC_EnemyManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	PendingQueries.Empty();
+	TargetCache.Empty();
+
+	if (Instance == this)
+	{
+		Instance = nullptr;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 // Called every frame
 void ACC_EnemyManager::Tick(float DeltaTime)
 {
@@ -71,12 +95,23 @@ ACC_EnemyManager* ACC_EnemyManager::Get(const UObject* WorldContextObject)
 
 void ACC_EnemyManager::RegisterEnemy(AActor* Enemy)
 {
-    if (!Enemy || ActiveEnemies.Contains(Enemy))
+    const ACC_EnemyCharacter* EnemyCharacter = Cast<ACC_EnemyCharacter>(Enemy);
+    const UCC_EnemyRegistry* Registry = UCC_EnemyRegistry::Get(this);
+    if (!EnemyCharacter || !Registry)
     {
         return;
     }
 
-    ActiveEnemies.Add(Enemy);
+    // Only enemies with a live registry handle are tracked
+    const FCC_EnemyHandle& Handle = EnemyCharacter->GetEnemyHandle();
+    if (!Registry->IsValidHandle(Handle) || !ActiveEnemies.Add(Handle))
+    {
+        return;
+    }
+
+    MaxEnemyRadius = FMath::Max(MaxEnemyRadius, Registry->GetRadius(Handle));
+    bSpatialHashDirty = true;
+    InvalidateTargetCache();
 
     UE_LOG(LogTemp, VeryVerbose, TEXT("[ENEMY MANAGER] Registered enemy (Total: %d)"), ActiveEnemies.Num());
 
@@ -84,13 +119,20 @@ void ACC_EnemyManager::RegisterEnemy(AActor* Enemy)
 
 void ACC_EnemyManager::UnregisterEnemy(AActor* Enemy)
 {
-    if (!Enemy)
+    const ACC_EnemyCharacter* EnemyCharacter = Cast<ACC_EnemyCharacter>(Enemy);
+    if (!EnemyCharacter)
+    {
+        return;
+    }
+
+    // Swap-and-pop by handle - only the last enemy changes index (the spatial hash is rebuilt anyway)
+    if (ActiveEnemies.Remove(EnemyCharacter->GetEnemyHandle()) == INDEX_NONE)
     {
         return;
     }
 
-    ActiveEnemies.Remove(Enemy);
-    NearestEnemyCache.Remove(Enemy);
+    bSpatialHashDirty = true;
+    InvalidateTargetCache();
 
     UE_LOG(LogTemp, VeryVerbose, TEXT("[ENEMY MANAGER] Unregistered enemy (Total: %d)"), ActiveEnemies.Num());
 
@@ -98,60 +140,740 @@ void ACC_EnemyManager::UnregisterEnemy(AActor* Enemy)
 
 AActor* ACC_EnemyManager::GetNearestEnemy(const FVector& Location, float MaxRadius)
 {
+    SCOPE_CYCLE_COUNTER(STAT_CC_NearestQuery);
+    INC_DWORD_STAT(STAT_CC_NearestQueries);
+
     if (ActiveEnemies.Num() == 0)
     {
         return nullptr;
     }
 
-    AActor* NearestEnemy = nullptr;
-    float NearestDistSq = MaxRadius * MaxRadius;
+    EnsureSpatialHash();
+
+    FVector Offsets[FCC_WorldWrap::MaxImages];
+    const int32 NumOffsets = WorldWrap.GetQueryOffsets(Location, MaxRadius, Offsets);
 
-    for (AActor* Enemy : ActiveEnemies)
+    int32 NearestEntry = INDEX_NONE;
+    float SearchRadius = MaxRadius;
+
+    // Ring search per wrap image - only cells around Location are touched,
+    // later images are bounded by the best distance found so far
+    for (int32 i = 0; i < NumOffsets; ++i)
     {
-        if (!Enemy || !IsValid(Enemy))
+        float DistSq = 0.0f;
+        const int32 Entry = SpatialHash.FindNearest(Snapshot, Location + Offsets[i], SearchRadius,
+            [this](int32 EntryIndex)
+            {
+                return Snapshot.Alive[EntryIndex] != 0;
+            },
+            &DistSq);
+
+        if (Entry != INDEX_NONE)
         {
-            continue;
+            NearestEntry = Entry;
+            SearchRadius = FMath::Sqrt(DistSq);
+        }
+    }
+
+    if (NearestEntry == INDEX_NONE)
+    {
+        return nullptr;
+    }
+
+    AActor* Enemy = Snapshot.Actors[NearestEntry];
+    if (!IsValid(Enemy))
+    {
+        return nullptr;
+    }
+
+    INC_DWORD_STAT(STAT_CC_QueryResults);
+    return Enemy;
+}
+
+AActor* ACC_EnemyManager::GetCachedNearestEnemy(const UObject* Querier, const FVector& Location, float MaxRadius)
+{
+    if (AActor* CachedTarget = FindCachedTarget(Querier, Location, MaxRadius))
+    {
+        return CachedTarget;
+    }
+
+    AActor* Target = GetNearestEnemy(Location, MaxRadius);
+    CacheTarget(Querier, Target, Location);
+
+    return Target;
+}
+
+AActor* ACC_EnemyManager::FindCachedTarget(const UObject* Querier, const FVector& Location, float MaxRadius,
+    TConstArrayView<const AActor*> ExcludeActors)
+{
+    const FCC_TargetCacheEntry* Entry = Querier ? TargetCache.Find(Querier) : nullptr;
+    AActor* Target = Entry ? Entry->Target.Get() : nullptr;
+
+    if (!Target || Entry->Generation != TargetCacheGeneration)
+    {
+        INC_DWORD_STAT(STAT_CC_TargetCacheMisses);
+        FrameCacheMisses++;
+        return nullptr;
+    }
+
+    const ACC_Character* Character = Cast<ACC_Character>(Target);
+    const bool bTargetAlive = !Character || Character->IsAlive();
+
+    const bool bQuerierMoved = WorldWrap.DistSquared(Location, Entry->QuerierLocation) > FMath::Square(TargetCacheMoveThreshold);
+    const bool bOutOfRange = WorldWrap.DistSquared(Location, Target->GetActorLocation()) >= FMath::Square(MaxRadius);
+    const bool bExpired = GetWorld()->GetTimeSeconds() - Entry->SearchTime > TargetCacheMaxAge;
+
+    if (!bTargetAlive || bQuerierMoved || bOutOfRange || bExpired || ExcludeActors.Contains(Target))
+    {
+        INC_DWORD_STAT(STAT_CC_TargetCacheMisses);
+        FrameCacheMisses++;
+        return nullptr;
+    }
+
+    INC_DWORD_STAT(STAT_CC_TargetCacheHits);
+    FrameCacheHits++;
+    return Target;
+}
+
+void ACC_EnemyManager::CacheTarget(const UObject* Querier, AActor* Target, const FVector& Location)
+{
+    if (!Querier)
+    {
+        return;
+    }
+
+    // No target - forget the entry so the next query searches again
+    if (!Target)
+    {
+        TargetCache.Remove(Querier);
+        return;
+    }
+
+    FCC_TargetCacheEntry& Entry = TargetCache.FindOrAdd(Querier);
+    Entry.Target = Target;
+    Entry.QuerierLocation = Location;
+    Entry.SearchTime = GetWorld()->GetTimeSeconds();
+    Entry.Generation = TargetCacheGeneration;
+}
+
+void ACC_EnemyManager::InvalidateTargetCache()
+{
+    // Entries are left in place (pruned later) - the generation check makes them misses
+    ++TargetCacheGeneration;
+}
+
+int32 ACC_EnemyManager::GetNearestEnemies(const FVector& Location, float MaxRadius, int32 Count, TArray<AActor*>& OutEnemies,
+    TConstArrayView<const AActor*> ExcludeActors)
+{
+    SCOPE_CYCLE_COUNTER(STAT_CC_KNearestQuery);
+    INC_DWORD_STAT(STAT_CC_KNearestQueries);
+    CC_SCOPE_QUERY_ALLOCATIONS(OutEnemies);
+
+    OutEnemies.Reset();
+    if (ActiveEnemies.Num() == 0 || Count <= 0)
+    {
+        return 0;
+    }
+
+    EnsureSpatialHash();
+
+    auto Filter = [this, ExcludeActors](int32 EntryIndex)
+        {
+            return Snapshot.Alive[EntryIndex] != 0 && !ExcludeActors.Contains(Snapshot.Actors[EntryIndex]);
+        };
+
+    FVector Offsets[FCC_WorldWrap::MaxImages];
+    const int32 NumOffsets = WorldWrap.GetQueryOffsets(Location, MaxRadius, Offsets);
+
+    TArray<FCC_NearestEntry, TInlineAllocator<32>> Nearest;
+    SpatialHash.FindKNearest(Snapshot, Location, MaxRadius, Count, Filter, Nearest);
+
+    // Wrap images near a seam - merge, keep each enemy once at its closest image
+    if (NumOffsets > 1)
+    {
+        TArray<FCC_NearestEntry, TInlineAllocator<32>> ImageNearest;
+        for (int32 i = 1; i < NumOffsets; ++i)
+        {
+            SpatialHash.FindKNearest(Snapshot, Location + Offsets[i], MaxRadius, Count, Filter, ImageNearest);
+            Nearest.Append(ImageNearest);
         }
 
-        float DistSq = FVector::DistSquared(Location, Enemy->GetActorLocation());
+        Nearest.Sort([](const FCC_NearestEntry& A, const FCC_NearestEntry& B)
+            {
+                return A.EntryIndex != B.EntryIndex ? A.EntryIndex < B.EntryIndex : A.DistSq < B.DistSq;
+            });
 
-        if (DistSq < NearestDistSq)
+        int32 WriteIndex = 0;
+        for (int32 ReadIndex = 0; ReadIndex < Nearest.Num(); ++ReadIndex)
         {
-            NearestDistSq = DistSq;
-            NearestEnemy = Enemy;
+            if (WriteIndex == 0 || Nearest[ReadIndex].EntryIndex != Nearest[WriteIndex - 1].EntryIndex)
+            {
+                Nearest[WriteIndex++] = Nearest[ReadIndex];
+            }
         }
+        Nearest.SetNum(WriteIndex, EAllowShrinking::No);
+
+        Nearest.Sort([](const FCC_NearestEntry& A, const FCC_NearestEntry& B) { return A.DistSq < B.DistSq; });
+        Nearest.SetNum(FMath::Min(Count, Nearest.Num()), EAllowShrinking::No);
     }
 
-    return NearestEnemy;
+    for (const FCC_NearestEntry& Entry : Nearest)
+    {
+        AActor* Enemy = Snapshot.Actors[Entry.EntryIndex];
+        if (IsValid(Enemy))
+        {
+            OutEnemies.Add(Enemy);
+        }
+    }
+
+    INC_DWORD_STAT_BY(STAT_CC_QueryResults, OutEnemies.Num());
+    return OutEnemies.Num();
+}
+
+int32 ACC_EnemyManager::GetRandomEnemies(const FVector& Location, float Radius, int32 Count, TArray<AActor*>& OutEnemies)
+{
+    SCOPE_CYCLE_COUNTER(STAT_CC_RandomQuery);
+    INC_DWORD_STAT(STAT_CC_RandomQueries);
+    CC_SCOPE_QUERY_ALLOCATIONS(OutEnemies);
+
+    OutEnemies.Reset();
+    if (Count <= 0)
+    {
+        return 0;
+    }
+
+    GetEntriesInRadius(Location, Radius, QueryScratchEntries);
+
+    const int32 PickCount = FMath::Min(Count, QueryScratchEntries.Num());
+    ShuffleFirstEntries(QueryScratchEntries, PickCount);
+    QueryScratchEntries.SetNum(PickCount, EAllowShrinking::No);
+
+    ResolveEntries(QueryScratchEntries, OutEnemies);
+
+    INC_DWORD_STAT_BY(STAT_CC_QueryResults, OutEnemies.Num());
+    return OutEnemies.Num();
 }
 
 TArray<AActor*> ACC_EnemyManager::GetEnemiesInRadius(const FVector& Location, float Radius)
 {
+    // Blueprint path - returning by value always allocates (counted in ResolveShapeQuery)
     TArray<AActor*> Result;
-    float RadiusSq = Radius * Radius;
+    GetEnemiesInRadius(Location, Radius, Result);
+    return Result;
+}
+
+int32 ACC_EnemyManager::GetEnemiesInRadius(const FVector& Location, float Radius, TArray<AActor*>& OutEnemies)
+{
+    return ResolveShapeQuery(FCC_EnemyShapeQuery::MakeSphere(Location, Radius), OutEnemies);
+}
+
+int32 ACC_EnemyManager::GetTotalEnemyCount() const
+{
+    const UCC_AIManager* AIManager = UCC_AIManager::Get(this);
+    return ActiveEnemies.Num() + (AIManager ? AIManager->GetProxyCount() : 0);
+}
+
+TArray<AActor*> ACC_EnemyManager::GetEnemiesInCone(const FVector& Origin, const FVector& Direction, float Range, float HalfAngle)
+{
+    TArray<AActor*> Result;
+    GetEnemiesInCone(Origin, Direction, Range, HalfAngle, Result);
+    return Result;
+}
+
+int32 ACC_EnemyManager::GetEnemiesInCone(const FVector& Origin, const FVector& Direction, float Range, float HalfAngle, TArray<AActor*>& OutEnemies)
+{
+    return ResolveShapeQuery(FCC_EnemyShapeQuery::MakeCone(Origin, Direction, Range, HalfAngle), OutEnemies);
+}
+
+TArray<AActor*> ACC_EnemyManager::GetEnemiesInBox(const FVector& Center, const FVector& HalfExtents, const FRotator& Rotation)
+{
+    TArray<AActor*> Result;
+    GetEnemiesInBox(Center, HalfExtents, Rotation, Result);
+    return Result;
+}
 
-    for (AActor* Enemy : ActiveEnemies)
+int32 ACC_EnemyManager::GetEnemiesInBox(const FVector& Center, const FVector& HalfExtents, const FRotator& Rotation, TArray<AActor*>& OutEnemies)
+{
+    return ResolveShapeQuery(FCC_EnemyShapeQuery::MakeBox(Center, HalfExtents, Rotation), OutEnemies);
+}
+
+int32 ACC_EnemyManager::ResolveShapeQuery(const FCC_EnemyShapeQuery& Query, TArray<AActor*>& OutEnemies)
+{
+    CC_SCOPE_QUERY_ALLOCATIONS(OutEnemies);
+
+    OutEnemies.Reset();
+    GetEntriesInShape(Query, QueryScratchEntries);
+    ResolveEntries(QueryScratchEntries, OutEnemies);
+
+    INC_DWORD_STAT_BY(STAT_CC_QueryResults, OutEnemies.Num());
+    return OutEnemies.Num();
+}
+
+void ACC_EnemyManager::GetEntriesInShape(const FCC_EnemyShapeQuery& Query, TArray<int32>& OutEntries)
+{
+    SCOPE_CYCLE_COUNTER(STAT_CC_ShapeQuery);
+    INC_DWORD_STAT(STAT_CC_ShapeQueries);
+    CC_SCOPE_QUERY_ALLOCATIONS(OutEntries);
+
+    OutEntries.Reset();
+    if (ActiveEnemies.Num() == 0 || Query.BoundingRadius < 0.0f)
     {
-        if (!Enemy || !IsValid(Enemy))
+        return;
+    }
+
+    EnsureSpatialHash();
+
+    GatherEntriesInShape(SpatialHash, Snapshot, WorldWrap, Query, OutEntries, bUseVectorKernels);
+}
+
+void ACC_EnemyManager::GatherEntriesInShape(const FCC_EnemySpatialHash& Hash, const FCC_EnemySnapshot& InSnapshot, const FCC_WorldWrap& Wrap,
+    const FCC_EnemyShapeQuery& Query, TArray<int32>& OutEntries, bool bVectorized)
+{
+    const float Bound = Query.BoundingRadius;
+
+    FVector Offsets[FCC_WorldWrap::MaxImages];
+    const int32 NumOffsets = Wrap.GetQueryOffsets(FVector(Query.Origin), Bound, Offsets);
+
+    for (int32 i = 0; i < NumOffsets; ++i)
+    {
+        FCC_EnemyShapeQuery ImageQuery = Query;
+        ImageQuery.Origin += FVector3f(Offsets[i]);
+
+        // Cells give contiguous snapshot slices - run the kernel once per slice
+        Hash.ForEachRangeInRect(
+            FVector2D(ImageQuery.Origin.X - Bound, ImageQuery.Origin.Y - Bound),
+            FVector2D(ImageQuery.Origin.X + Bound, ImageQuery.Origin.Y + Bound),
+            [&](int32 StartEntry, int32 EndEntry)
+            {
+                FCC_EnemyQueryKernels::Filter(InSnapshot, StartEntry, EndEntry, ImageQuery, OutEntries, bVectorized);
+            });
+    }
+
+    // Images of a small shape never overlap - only wide queries can see an enemy twice
+    if (NumOffsets > 1 && Wrap.CanOverlapImages(Bound))
+    {
+        FCC_EnemyQueryKernels::RemoveDuplicateEntries(OutEntries);
+    }
+}
+
+void ACC_EnemyManager::SetWorldWrap(const FVector& Center, const FVector2D& Period)
+{
+    WorldWrap.Set(Center, Period);
+    InvalidateTargetCache();
+
+    UE_LOG(LogTemp, Log, TEXT("[ENEMY MANAGER] World wrap set (Center: %s, Period: %s)"), *Center.ToString(), *Period.ToString());
+}
+
+void ACC_EnemyManager::ClearWorldWrap()
+{
+    WorldWrap.Reset();
+    InvalidateTargetCache();
+}
+
+FVector ACC_EnemyManager::GetNearestImageLocation(const FVector& From, const FVector& TargetLocation) const
+{
+    return WorldWrap.NearestImage(From, TargetLocation);
+}
+
+void ACC_EnemyManager::GetEntriesInRadius(const FVector& Location, float Radius, TArray<int32>& OutEntries)
+{
+    GetEntriesInShape(FCC_EnemyShapeQuery::MakeSphere(Location, Radius), OutEntries);
+}
+
+const FCC_EnemySnapshot& ACC_EnemyManager::GetEnemySnapshot()
+{
+    EnsureSpatialHash();
+    return Snapshot;
+}
+
+const FCC_EnemySpatialHash& ACC_EnemyManager::GetSpatialHash()
+{
+    EnsureSpatialHash();
+    return SpatialHash;
+}
+
+FCC_EnemyQueryHandle ACC_EnemyManager::SubmitQuery(const UObject* Requester, const FCC_EnemyQueryRequest& Request, FCC_EnemyQueryCallback OnResolved)
+{
+    FCC_EnemyQueryHandle Handle;
+    if (!OnResolved)
+    {
+        return Handle;
+    }
+
+    FCC_PendingEnemyQuery& Query = PendingQueries.AddDefaulted_GetRef();
+    Query.Id = NextQueryId++;
+    Query.Requester = Requester;
+    Query.Request = Request;
+    Query.OnResolved = MoveTemp(OnResolved);
+
+    Handle.Id = Query.Id;
+    return Handle;
+}
+
+void ACC_EnemyManager::CancelQuery(FCC_EnemyQueryHandle& Handle)
+{
+    if (!Handle.IsValid())
+    {
+        return;
+    }
+
+    const int32 Id = Handle.Id;
+    PendingQueries.RemoveAll([Id](const FCC_PendingEnemyQuery& Query) {
+        return Query.Id == Id;
+        });
+
+    // Already in the resolving batch - just drop the callback
+    for (FCC_PendingEnemyQuery& Query : ResolvingQueries)
+    {
+        if (Query.Id == Id)
+        {
+            Query.OnResolved = nullptr;
+        }
+    }
+
+    Handle.Invalidate();
+}
+
+void ACC_EnemyManager::FlushPendingQueries()
+{
+    ResolvePendingQueries();
+}
+
+void ACC_EnemyManager::RunQuery(const FCC_EnemyQueryRequest& Request, TArray<AActor*>& OutEnemies)
+{
+    CC_SCOPE_QUERY_ALLOCATIONS(OutEnemies);
+
+    OutEnemies.Reset();
+    GetEntriesInShape(Request.Shape, QueryScratchEntries);
+    SelectQueryResults(Request, QueryScratchEntries, OutEnemies);
+
+    INC_DWORD_STAT_BY(STAT_CC_QueryResults, OutEnemies.Num());
+}
+
+void ACC_EnemyManager::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+    if (World != GetWorld())
+    {
+        return;
+    }
+
+    // Enemies have moved this frame - rebuild once, then serve the batch and
+    // next frame's synchronous queries from the same snapshot
+    RebuildSpatialHash();
+    ResolvePendingQueries();
+
+    // Hit rate over every lookup of this frame (sync + batched)
+    const int32 CacheLookups = FrameCacheHits + FrameCacheMisses;
+    SET_FLOAT_STAT(STAT_CC_TargetCacheHitRate, CacheLookups > 0 ? 100.0f * FrameCacheHits / CacheLookups : 0.0f);
+    FrameCacheHits = 0;
+    FrameCacheMisses = 0;
+}
+
+void ACC_EnemyManager::ResolvePendingQueries()
+{
+    if (PendingQueries.Num() == 0 || ResolvingQueries.Num() > 0)
+    {
+        return;
+    }
+
+    TRACE_CPUPROFILER_EVENT_SCOPE(ACC_EnemyManager::ResolvePendingQueries);
+    SCOPE_CYCLE_COUNTER(STAT_CC_BatchResolve);
+
+    // Callbacks may submit new queries - those go to the next batch
+    Swap(PendingQueries, ResolvingQueries);
+
+    EnsureSpatialHash();
+
+    // Slot buffers only ever grow - a steady number of queries per frame allocates nothing
+    const int32 NumQueries = ResolvingQueries.Num();
+    INC_DWORD_STAT_BY(STAT_CC_BatchedQueries, NumQueries);
+    if (BatchEntries.Num() < NumQueries)
+    {
+        INC_DWORD_STAT(STAT_CC_QueryAllocations);
+        BatchEntries.SetNum(NumQueries);
+        BatchResults.SetNum(NumQueries);
+    }
+
+    // 1. Expand wrap images and merge bounding rects
+    FVector2D UnionMin(MAX_flt, MAX_flt);
+    FVector2D UnionMax(-MAX_flt, -MAX_flt);
+
+    BatchImages.Reset();
+
+    for (int32 Slot = 0; Slot < NumQueries; ++Slot)
+    {
+        FCC_PendingEnemyQuery& Query = ResolvingQueries[Slot];
+        BatchEntries[Slot].Reset();
+
+        const FCC_EnemyShapeQuery& Shape = Query.Request.Shape;
+
+        // Auto-aim repeating on the same target - no grid work at all
+        Query.bCacheHit = false;
+        if (Query.Request.bUseTargetCache)
+        {
+            AActor* CachedTarget = FindCachedTarget(Query.Requester.Get(), FVector(Shape.Origin),
+                FMath::Sqrt(Shape.RadiusSq), Query.Request.ExcludeActors);
+
+            if (CachedTarget)
+            {
+                BatchResults[Slot].Reset();
+                BatchResults[Slot].Add(CachedTarget);
+                Query.bCacheHit = true;
+                continue;
+            }
+        }
+
+        const float Bound = FMath::Max(Shape.BoundingRadius, 0.0f);
+
+        FVector Offsets[FCC_WorldWrap::MaxImages];
+        const int32 NumOffsets = WorldWrap.GetQueryOffsets(FVector(Shape.Origin), Bound, Offsets);
+
+        for (int32 i = 0; i < NumOffsets; ++i)
+        {
+            FCC_PendingQueryImage& Image = BatchImages.AddDefaulted_GetRef();
+            Image.Slot = Slot;
+            Image.Shape = Shape;
+            Image.Shape.Origin += FVector3f(Offsets[i]);
+
+            const FVector2D ImageMin(Image.Shape.Origin.X - Bound, Image.Shape.Origin.Y - Bound);
+            const FVector2D ImageMax(Image.Shape.Origin.X + Bound, Image.Shape.Origin.Y + Bound);
+
+            Image.MinCell = SpatialHash.GetCellCoord(FVector(ImageMin.X, ImageMin.Y, 0.0f));
+            Image.MaxCell = SpatialHash.GetCellCoord(FVector(ImageMax.X, ImageMax.Y, 0.0f));
+
+            UnionMin = FVector2D::Min(UnionMin, ImageMin);
+            UnionMax = FVector2D::Max(UnionMax, ImageMax);
+        }
+    }
+
+    // 2. One walk over the grid - each cell is tested against every query image covering it
+    if (BatchImages.Num() > 0)
+    {
+        SpatialHash.ForEachCellInRect(UnionMin, UnionMax,
+            [this](const FIntPoint& Cell, int32 StartEntry, int32 EndEntry)
+            {
+                for (const FCC_PendingQueryImage& Image : BatchImages)
+                {
+                    if (Cell.X < Image.MinCell.X || Cell.X > Image.MaxCell.X ||
+                        Cell.Y < Image.MinCell.Y || Cell.Y > Image.MaxCell.Y)
+                    {
+                        continue;
+                    }
+
+                    TArray<int32>& Entries = BatchEntries[Image.Slot];
+                    CC_SCOPE_QUERY_ALLOCATIONS(Entries);
+                    FCC_EnemyQueryKernels::Filter(Snapshot, StartEntry, EndEntry, Image.Shape, Entries, bUseVectorKernels);
+                }
+            });
+    }
+
+    // 3. Select and resolve every query before any callback runs
+    //    (callbacks can kill or spawn enemies, which invalidates the snapshot)
+    for (int32 Slot = 0; Slot < NumQueries; ++Slot)
+    {
+        const FCC_PendingEnemyQuery& Query = ResolvingQueries[Slot];
+        if (Query.bCacheHit)
         {
             continue;
         }
 
-        float DistSq = FVector::DistSquared(Location, Enemy->GetActorLocation());
+        TArray<AActor*>& Results = BatchResults[Slot];
+        CC_SCOPE_QUERY_ALLOCATIONS(Results);
+
+        // Wide shapes near a seam may have seen an enemy through two images
+        if (WorldWrap.CanOverlapImages(Query.Request.Shape.BoundingRadius))
+        {
+            FCC_EnemyQueryKernels::RemoveDuplicateEntries(BatchEntries[Slot]);
+        }
+
+        Results.Reset();
+        SelectQueryResults(Query.Request, BatchEntries[Slot], Results);
 
-        if (DistSq <= RadiusSq)
+        if (Query.Request.bUseTargetCache)
         {
-            Result.Add(Enemy);
+            CacheTarget(Query.Requester.Get(), Results.Num() > 0 ? Results[0] : nullptr, FVector(Query.Request.Shape.Origin));
         }
     }
 
-    return Result;
+    // 4. Deliver
+    for (int32 Slot = 0; Slot < NumQueries; ++Slot)
+    {
+        FCC_PendingEnemyQuery& Query = ResolvingQueries[Slot];
+        if (Query.OnResolved && Query.Requester.IsValid())
+        {
+            INC_DWORD_STAT_BY(STAT_CC_QueryResults, BatchResults[Slot].Num());
+            Query.OnResolved(BatchResults[Slot]);
+        }
+    }
+
+    UE_LOG(LogTemp, VeryVerbose, TEXT("[ENEMY MANAGER] Resolved %d queries in one pass"), ResolvingQueries.Num());
+
+    ResolvingQueries.Reset();
+}
+
+void ACC_EnemyManager::SelectQueryResults(const FCC_EnemyQueryRequest& Request, TArray<int32>& Entries, TArray<AActor*>& OutEnemies) const
+{
+    if (Request.ExcludeActors.Num() > 0)
+    {
+        Entries.RemoveAll([this, &Request](int32 EntryIndex) {
+            return Request.ExcludeActors.Contains(Snapshot.Actors[EntryIndex]);
+            });
+    }
+
+    const int32 MaxResults = Request.MaxResults > 0 ? FMath::Min(Request.MaxResults, Entries.Num()) : Entries.Num();
+
+    switch (Request.Select)
+    {
+    case ECC_EnemyQuerySelect::Nearest:
+        FCC_EnemyQueryKernels::SelectNearest(Snapshot, FVector(Request.Shape.Origin), MaxResults, Entries, &WorldWrap);
+        break;
+
+    case ECC_EnemyQuerySelect::Random:
+        ShuffleFirstEntries(Entries, MaxResults);
+        break;
+
+    case ECC_EnemyQuerySelect::All:
+    default:
+        break;
+    }
+
+    Entries.SetNum(MaxResults, EAllowShrinking::No);
+
+    ResolveEntries(Entries, OutEnemies);
+}
+
+void ACC_EnemyManager::ShuffleFirstEntries(TArray<int32>& Entries, int32 Count)
+{
+    // Partial Fisher-Yates - only the first Count slots are randomized
+    const int32 LastIndex = Entries.Num() - 1;
+    for (int32 i = 0; i < Count; ++i)
+    {
+        Entries.Swap(i, FMath::RandRange(i, LastIndex));
+    }
+}
+
+void ACC_EnemyManager::SetSpatialCellSize(float NewCellSize)
+{
+    SpatialCellSize = FMath::Max(NewCellSize, 50.0f);
+    SpatialHash.SetCellSize(SpatialCellSize);
+    bSpatialHashDirty = true;
+
+    UE_LOG(LogTemp, Log, TEXT("[ENEMY MANAGER] Spatial cell size set to %.0f"), SpatialCellSize);
+}
+
+void ACC_EnemyManager::RemoveInvalidEnemies()
+{
+    // Rare (enemies unregister before their handle ends) - a generation compare each, no actor access
+    if (const UCC_EnemyRegistry* Registry = UCC_EnemyRegistry::Get(this))
+    {
+        if (ActiveEnemies.RemoveStale(*Registry) > 0)
+        {
+            bSpatialHashDirty = true;
+        }
+    }
+}
+
+TArray<AActor*> ACC_EnemyManager::GetAllEnemies() const
+{
+    TArray<AActor*> Enemies;
+
+    const UCC_EnemyRegistry* Registry = UCC_EnemyRegistry::Get(this);
+    if (!Registry)
+    {
+        return Enemies;
+    }
+
+    Enemies.Reserve(ActiveEnemies.Num());
+    for (const FCC_EnemyHandle& Handle : ActiveEnemies)
+    {
+        if (ACC_EnemyCharacter* Enemy = Registry->Resolve(Handle))
+        {
+            Enemies.Add(Enemy);
+        }
+    }
+    return Enemies;
+}
+
+void ACC_EnemyManager::RebuildSpatialHash()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(ACC_EnemyManager::RebuildSpatialHash);
+    SCOPE_CYCLE_COUNTER(STAT_CC_SpatialRebuild);
+
+    // Drop ended handles first so indices stay valid for the whole frame
+    RemoveInvalidEnemies();
+
+    const UCC_EnemyRegistry* Registry = UCC_EnemyRegistry::Get(this);
+    if (!Registry)
+    {
+        Snapshot.Reset();
+        bSpatialHashDirty = false;
+        return;
+    }
+
+    // The only pass that touches the actors - everything after reads the snapshot
+    const int32 NumEnemies = ActiveEnemies.Num();
+    EnemyLocations.SetNumUninitialized(NumEnemies);
+    for (int32 i = 0; i < NumEnemies; ++i)
+    {
+        EnemyLocations[i] = Registry->Resolve(ActiveEnemies[i])->GetActorLocation();
+    }
+
+    SpatialHash.Build(EnemyLocations);
+
+    // Scatter into hash entry order so every cell is a contiguous slice
+    Snapshot.SetNum(NumEnemies);
+    for (int32 EntryIndex = 0; EntryIndex < NumEnemies; ++EntryIndex)
+    {
+        const int32 SourceIndex = SpatialHash.GetSourceIndex(EntryIndex);
+        const FCC_EnemyHandle& Handle = ActiveEnemies[SourceIndex];
+        const FVector& Location = EnemyLocations[SourceIndex];
+
+        // Radius and alive straight from the registry's dense arrays
+        Snapshot.X[EntryIndex] = Location.X;
+        Snapshot.Y[EntryIndex] = Location.Y;
+        Snapshot.Z[EntryIndex] = Location.Z;
+        Snapshot.Radius[EntryIndex] = Registry->GetRadius(Handle);
+        Snapshot.Alive[EntryIndex] = Registry->IsAlive(Handle) ? 1 : 0;
+        Snapshot.Handle[EntryIndex] = Handle;
+        Snapshot.Actors[EntryIndex] = Registry->Resolve(Handle);
+    }
+
+    bSpatialHashDirty = false;
+}
+
+void ACC_EnemyManager::EnsureSpatialHash()
+{
+    if (bSpatialHashDirty)
+    {
+        RebuildSpatialHash();
+    }
+}
+
+void ACC_EnemyManager::ResolveEntries(const TArray<int32>& Entries, TArray<AActor*>& OutEnemies) const
+{
+    OutEnemies.Reserve(OutEnemies.Num() + Entries.Num());
+    for (int32 EntryIndex : Entries)
+    {
+        AActor* Enemy = Snapshot.Actors[EntryIndex];
+        if (IsValid(Enemy))
+        {
+            OutEnemies.Add(Enemy);
+        }
+    }
 }
 
 void ACC_EnemyManager::UpdateNearestEnemyCache()
 {
     // Remove invalid enemies
-    ActiveEnemies.RemoveAll([](AActor* Enemy) {
-        return !IsValid(Enemy);
-        });
+    RemoveInvalidEnemies();
+
+    // Drop entries of destroyed queriers / targets and older generations
+    for (auto It = TargetCache.CreateIterator(); It; ++It)
+    {
+        const FCC_TargetCacheEntry& Entry = It.Value();
+        if (!It.Key().IsValid() || !Entry.Target.IsValid() || Entry.Generation != TargetCacheGeneration)
+        {
+            It.RemoveCurrent();
+        }
+    }
 }
@@ -4,6 +4,10 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "CC_EnemySpatialHash.h"
+#include "CC_EnemyQueryKernels.h"
+#include "CC_EnemyQueryBatch.h"
+#include "CC_EnemyRegistry.h"
 #include "CC_EnemyManager.generated.h"
 
 
@@ -24,6 +28,8 @@ protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:	
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
@@ -36,13 +42,34 @@ protected:
     // ENEMY TRACKING
     //==========================================================================
 
-    // All active enemies
-    UPROPERTY()
-    TArray<AActor*> ActiveEnemies;
+    // All active enemies, by UCC_EnemyRegistry handle (radius and alive come from the registry)
+    FCC_EnemyHandleSet ActiveEnemies;
 
-    // Cache for nearest enemy queries
-    UPROPERTY()
-    TMap<AActor*, AActor*> NearestEnemyCache;
+    // Largest collision radius seen so far (point queries pad by this to mimic overlaps)
+    float MaxEnemyRadius = 0.0f;
+
+    //==========================================================================
+    // TARGET CACHE
+    //==========================================================================
+
+    // Last nearest target per querier - reused until it dies, leaves range,
+    // the querier moves past the threshold or the entry ages out
+    TMap<TWeakObjectPtr<const UObject>, FCC_TargetCacheEntry> TargetCache;
+
+    // Bumped on register/unregister - entries from older generations are misses
+    uint32 TargetCacheGeneration = 0;
+
+    // Lookups this frame (hit rate stat)
+    int32 FrameCacheHits = 0;
+    int32 FrameCacheMisses = 0;
+
+    // Querier movement that forces a new search
+    UPROPERTY(EditAnywhere, Category = "Performance", meta = (ClampMin = "0.0"))
+    float TargetCacheMoveThreshold = 150.0f;
+
+    // Oldest cached target still trusted (other enemies may have come closer)
+    UPROPERTY(EditAnywhere, Category = "Performance", meta = (ClampMin = "0.0"))
+    float TargetCacheMaxAge = 0.5f;
 
     // Update interval for cache (0.1s = 10 FPS)
     UPROPERTY(EditAnywhere, Category = "Performance")
@@ -50,6 +77,58 @@ protected:
 
     float TimeSinceLastUpdate = 0.0f;
 
+    //==========================================================================
+    // SPATIAL HASH
+    //==========================================================================
+
+    // Cell size of the enemy spatial hash (roughly the typical weapon radius)
+    UPROPERTY(EditAnywhere, Category = "Performance", meta = (ClampMin = "50.0"))
+    float SpatialCellSize = 800.0f;
+
+    // Uniform grid over ActiveEnemies, rebuilt once per frame (end of frame)
+    FCC_EnemySpatialHash SpatialHash;
+
+    // SoA copy of all enemies in spatial hash entry order
+    UPROPERTY()
+    FCC_EnemySnapshot Snapshot;
+
+    // Enemy locations gathered for the current build (index = ActiveEnemies index)
+    TArray<FVector> EnemyLocations;
+
+    // Set on register/unregister so queries never see shifted indices
+    bool bSpatialHashDirty = true;
+
+    // Use the SIMD shape kernels (off = scalar reference, for comparison)
+    UPROPERTY(EditAnywhere, Category = "Performance")
+    bool bUseVectorKernels = true;
+
+    // Wrapping world (set by the tile manager) - queries see enemies across the seams
+    FCC_WorldWrap WorldWrap;
+
+    //==========================================================================
+    // BATCHED QUERIES
+    //==========================================================================
+
+    // Submitted this frame, resolved after all actor ticks and timers
+    TArray<FCC_PendingEnemyQuery> PendingQueries;
+
+    // Batch currently being resolved (callbacks may submit into PendingQueries)
+    TArray<FCC_PendingEnemyQuery> ResolvingQueries;
+
+    // Wrap images of the resolving batch (one per query when the world does not wrap)
+    TArray<FCC_PendingQueryImage> BatchImages;
+
+    // Per-slot gather/result buffers of the resolving batch (kept across frames, never shrunk)
+    TArray<TArray<int32>> BatchEntries;
+    TArray<TArray<AActor*>> BatchResults;
+
+    // Entry scratch for synchronous queries (reused - no allocation per call)
+    TArray<int32> QueryScratchEntries;
+
+    int32 NextQueryId = 1;
+
+    FDelegateHandle PostActorTickHandle;
+
 public:
     //==========================================================================
     // PUBLIC INTERFACE
@@ -71,19 +150,160 @@ public:
     UFUNCTION(BlueprintPure, Category = "Enemy Manager")
     AActor* GetNearestEnemy(const FVector& Location, float MaxRadius = 10000.0f);
 
+    /**
+     * Nearest enemy for Querier, temporally coherent
+     * Returns Querier's last target while it is alive, in range and the querier has not moved much;
+     * otherwise searches the grid and caches the new target
+     */
+    AActor* GetCachedNearestEnemy(const UObject* Querier, const FVector& Location, float MaxRadius);
+
+    // Querier's cached target if it is still usable (nullptr = a search is needed)
+    AActor* FindCachedTarget(const UObject* Querier, const FVector& Location, float MaxRadius,
+        TConstArrayView<const AActor*> ExcludeActors = TConstArrayView<const AActor*>());
+
+    // Remember Target as Querier's current target (searched from Location)
+    void CacheTarget(const UObject* Querier, AActor* Target, const FVector& Location);
+
+    // Drop every cached target (next query of each querier searches again)
+    void InvalidateTargetCache();
+
     // Get all enemies in radius
     UFUNCTION(BlueprintPure, Category = "Enemy Manager")
     TArray<AActor*> GetEnemiesInRadius(const FVector& Location, float Radius);
 
+    // Caller-owned buffer version - OutEnemies is reset (capacity kept), returns the count
+    int32 GetEnemiesInRadius(const FVector& Location, float Radius, TArray<AActor*>& OutEnemies);
+
+    /**
+     * K nearest enemies within MaxRadius, nearest first
+     * Grid ring search with a bounded heap - OutEnemies is reset (capacity kept)
+     * @return Number of enemies found
+     */
+    int32 GetNearestEnemies(const FVector& Location, float MaxRadius, int32 Count, TArray<AActor*>& OutEnemies,
+        TConstArrayView<const AActor*> ExcludeActors = TConstArrayView<const AActor*>());
+
+    /**
+     * Count random enemies within Radius
+     * Partial Fisher-Yates on the gathered entries - O(Count) picks, no RemoveAt shifting
+     * @return Number of enemies picked
+     */
+    int32 GetRandomEnemies(const FVector& Location, float Radius, int32 Count, TArray<AActor*>& OutEnemies);
+
+    // Get all enemies inside a cone (HalfAngle in degrees)
+    UFUNCTION(BlueprintPure, Category = "Enemy Manager")
+    TArray<AActor*> GetEnemiesInCone(const FVector& Origin, const FVector& Direction, float Range, float HalfAngle);
+
+    int32 GetEnemiesInCone(const FVector& Origin, const FVector& Direction, float Range, float HalfAngle, TArray<AActor*>& OutEnemies);
+
+    // Get all enemies inside an oriented box
+    UFUNCTION(BlueprintPure, Category = "Enemy Manager")
+    TArray<AActor*> GetEnemiesInBox(const FVector& Center, const FVector& HalfExtents, const FRotator& Rotation);
+
+    int32 GetEnemiesInBox(const FVector& Center, const FVector& HalfExtents, const FRotator& Rotation, TArray<AActor*>& OutEnemies);
+
+    // Snapshot entries (alive only) inside the shape - positions are read from GetEnemySnapshot()
+    void GetEntriesInShape(const FCC_EnemyShapeQuery& Query, TArray<int32>& OutEntries);
+
+    void GetEntriesInRadius(const FVector& Location, float Radius, TArray<int32>& OutEntries);
+
+    // Current SoA snapshot (rebuilt first if registrations changed)
+    const FCC_EnemySnapshot& GetEnemySnapshot();
+
+    // Hash over the GetEnemySnapshot() entries (same rebuild rule)
+    const FCC_EnemySpatialHash& GetSpatialHash();
+
+    /**
+     * Snapshot entries inside the shape, wrap-aware
+     * The shape is tested at every wrap image overlapping the domain; an enemy is never listed twice.
+     */
+    static void GatherEntriesInShape(const FCC_EnemySpatialHash& Hash, const FCC_EnemySnapshot& InSnapshot, const FCC_WorldWrap& Wrap,
+        const FCC_EnemyShapeQuery& Query, TArray<int32>& OutEntries, bool bVectorized = true);
+
+    //==========================================================================
+    // WORLD WRAP
+    //==========================================================================
+
+    /**
+     * Make every query toroidal: distances use the closest image across the XY seams
+     * @param Center - center of the wrapped area
+     * @param Period - teleport distance on X / Y (TileSize * 3, CubeSize)
+     */
+    UFUNCTION(BlueprintCallable, Category = "Enemy Manager")
+    void SetWorldWrap(const FVector& Center, const FVector2D& Period);
+
+    UFUNCTION(BlueprintCallable, Category = "Enemy Manager")
+    void ClearWorldWrap();
+
+    const FCC_WorldWrap& GetWorldWrap() const { return WorldWrap; }
+
+    // Where to aim at Target from From (its closest image)
+    UFUNCTION(BlueprintPure, Category = "Enemy Manager")
+    FVector GetNearestImageLocation(const FVector& From, const FVector& TargetLocation) const;
+
+    /**
+     * Queue a targeting query - all queries of a frame share one pass over the enemy grid
+     * @param Requester - callback is dropped if this object is destroyed before resolution
+     * @param OnResolved - called the same frame, after actor ticks and timers
+     */
+    FCC_EnemyQueryHandle SubmitQuery(const UObject* Requester, const FCC_EnemyQueryRequest& Request, FCC_EnemyQueryCallback OnResolved);
+
+    // Drop a query that has not resolved yet
+    void CancelQuery(FCC_EnemyQueryHandle& Handle);
+
+    // Resolve everything queued so far right now
+    void FlushPendingQueries();
+
+    // Run one query immediately (same selection rules as SubmitQuery)
+    void RunQuery(const FCC_EnemyQueryRequest& Request, TArray<AActor*>& OutEnemies);
+
+    // Change spatial hash cell size (forces a rebuild)
+    UFUNCTION(BlueprintCallable, Category = "Enemy Manager")
+    void SetSpatialCellSize(float NewCellSize);
+
     // Get enemy count
     UFUNCTION(BlueprintPure, Category = "Enemy Manager")
     int32 GetEnemyCount() const { return ActiveEnemies.Num(); }
 
-    // Get all enemies
+    // Enemy actors plus actor-less proxies (UCC_AIManager)
+    UFUNCTION(BlueprintPure, Category = "Enemy Manager")
+    int32 GetTotalEnemyCount() const;
+
+    // Largest registered enemy collision radius
+    UFUNCTION(BlueprintPure, Category = "Enemy Manager")
+    float GetMaxEnemyRadius() const { return MaxEnemyRadius; }
+
+    // Get all enemies (resolved from their handles)
     UFUNCTION(BlueprintPure, Category = "Enemy Manager")
-    const TArray<AActor*>& GetAllEnemies() const { return ActiveEnemies; }
+    TArray<AActor*> GetAllEnemies() const;
 
 protected:
-    // Update cache
+    // Prune invalid enemies and stale target cache entries
     void UpdateNearestEnemyCache();
+
+    // Drop destroyed actors (keeps registration arrays in sync)
+    void RemoveInvalidEnemies();
+
+    // Gather enemy data, rebuild the spatial hash and the snapshot
+    void RebuildSpatialHash();
+
+    // Rebuild only if registrations changed since the last build
+    void EnsureSpatialHash();
+
+    // Entries -> valid actors
+    void ResolveEntries(const TArray<int32>& Entries, TArray<AActor*>& OutEnemies) const;
+
+    // Shape -> valid actors through the scratch entries
+    int32 ResolveShapeQuery(const FCC_EnemyShapeQuery& Query, TArray<AActor*>& OutEnemies);
+
+    // End of frame hook (after TG_PostUpdateWork and the timer manager)
+    void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+    // Single pass over the union of all pending query rects
+    void ResolvePendingQueries();
+
+    // Exclusion + Nearest/Random/All selection on one query's gathered entries
+    void SelectQueryResults(const FCC_EnemyQueryRequest& Request, TArray<int32>& Entries, TArray<AActor*>& OutEnemies) const;
+
+    // Move Count random entries to the front (partial Fisher-Yates)
+    static void ShuffleFirstEntries(TArray<int32>& Entries, int32 Count);
 };
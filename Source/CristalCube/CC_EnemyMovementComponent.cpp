@@ -0,0 +1,134 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CC_EnemyMovementComponent.h"
+#include "GameFramework/Character.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+
+UCC_EnemyMovementComponent::UCC_EnemyMovementComponent()
+{
+	// Enemies are server-driven crowds, nothing to smooth
+	NetworkSmoothingMode = ENetworkSmoothingMode::Disabled;
+
+	// Basic enemies are never possessed - the full update must still run for them
+	bRunPhysicsWithNoController = true;
+}
+
+void UCC_EnemyMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	if (!bLightweight)
+	{
+		Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+		return;
+	}
+
+	// Skip the CharacterMovement update, keep the base movement component bookkeeping
+	UPawnMovementComponent::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	UpdateLightweight(DeltaTime);
+}
+
+void UCC_EnemyMovementComponent::UpdateLightweight(float DeltaTime)
+{
+	if (!bLightweight || !UpdatedComponent || !CharacterOwner || DeltaTime <= 0.0f)
+	{
+		return;
+	}
+
+	// Movement switched off (ACC_Character::Die) - stand still, drop any queued input
+	if (MovementMode == MOVE_None)
+	{
+		ConsumeInputVector();
+		Velocity = FVector::ZeroVector;
+		UpdateComponentVelocity();
+		return;
+	}
+
+	if (!bHasGroundHeight)
+	{
+		FindGroundHeight();
+	}
+
+	// Planar velocity toward the input, braking when there is none
+	const FVector Input = ConsumeInputVector().GetClampedToMaxSize(1.0f);
+	const FVector DesiredVelocity(Input.X * GetMaxSpeed(), Input.Y * GetMaxSpeed(), 0.0f);
+	const float Rate = Input.IsNearlyZero() ? BrakingDecelerationWalking : GetMaxAcceleration();
+	Velocity = FMath::VInterpConstantTo(FVector(Velocity.X, Velocity.Y, 0.0f), DesiredVelocity, DeltaTime, Rate);
+
+	FVector Delta = Velocity * DeltaTime;
+
+	// Stay on the single ground height (capsule bottom on the floor)
+	const float HalfHeight = CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	Delta.Z = GroundHeight + HalfHeight - UpdatedComponent->GetComponentLocation().Z;
+
+	if (Delta.IsNearlyZero())
+	{
+		UpdateComponentVelocity();
+		return;
+	}
+
+	if (bSweepLightweightMove)
+	{
+		// Blocked: slide next frame instead of a second sweep now
+		FHitResult Hit;
+		MoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), true, &Hit);
+		if (Hit.IsValidBlockingHit())
+		{
+			Velocity = FVector::VectorPlaneProject(Velocity, Hit.Normal);
+			Velocity.Z = 0.0f;
+		}
+	}
+	else
+	{
+		MoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), false);
+	}
+
+	UpdateComponentVelocity();
+}
+
+void UCC_EnemyMovementComponent::SetLightweight(bool bNewLightweight)
+{
+	if (bLightweight == bNewLightweight)
+	{
+		return;
+	}
+
+	bLightweight = bNewLightweight;
+
+	// The full update expects a valid walking state, the lightweight one never changes it
+	if (!bLightweight && CharacterOwner)
+	{
+		SetMovementMode(MOVE_Walking);
+	}
+}
+
+void UCC_EnemyMovementComponent::SetGroundHeight(float NewGroundHeight)
+{
+	GroundHeight = NewGroundHeight;
+	bHasGroundHeight = true;
+}
+
+void UCC_EnemyMovementComponent::FindGroundHeight()
+{
+	const float HalfHeight = CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	const FVector Start = UpdatedComponent->GetComponentLocation();
+
+	// Fallback: stay where spawned
+	GroundHeight = Start.Z - HalfHeight;
+	bHasGroundHeight = true;
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(CC_EnemyGroundHeight), false, CharacterOwner);
+
+	FHitResult Hit;
+	if (World->LineTraceSingleByChannel(Hit, Start, Start - FVector(0.0f, 0.0f, HalfHeight + GroundTraceDistance), ECC_WorldStatic, Params))
+	{
+		GroundHeight = Hit.ImpactPoint.Z;
+	}
+}
@@ -0,0 +1,60 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "CC_EnemyMovementComponent.generated.h"
+
+/**
+ * Movement for basic enemies on the flat cube floor
+ * Lightweight mode skips the CharacterMovement walking update (floor sweeps, step-up, network smoothing):
+ * planar velocity toward the input, Z held at one ground height, at most one sweep against the world.
+ * UCC_AIManager moves registered enemies itself right after steering (component tick off);
+ * unregistered enemies tick it like any other component. With lightweight mode off (bosses,
+ * FCristalCubeEnemyStats::bFullCharacterMovement) it is the regular UCharacterMovementComponent.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class CRISTALCUBE_API UCC_EnemyMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	UCC_EnemyMovementComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	// Consume the pending input and move (lightweight mode only)
+	void UpdateLightweight(float DeltaTime);
+
+	void SetLightweight(bool bNewLightweight);
+
+	UFUNCTION(BlueprintPure, Category = "Enemy Movement")
+	bool IsLightweight() const { return bLightweight; }
+
+	// Floor height the capsule bottom sits on (found with one downward trace when not set)
+	void SetGroundHeight(float NewGroundHeight);
+
+	// Forget the floor height - traced again on the next lightweight update (teleport, pooled reuse)
+	void ResetGroundHeight() { bHasGroundHeight = false; }
+
+protected:
+
+	// Planar move instead of the full walking update
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy Movement")
+	bool bLightweight = true;
+
+	// One sweep per move against whatever the capsule blocks (world, player); off = teleport-style move
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy Movement")
+	bool bSweepLightweightMove = true;
+
+	// How far below the capsule the ground trace looks
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy Movement", meta = (ClampMin = "0.0"))
+	float GroundTraceDistance = 1000.0f;
+
+private:
+	void FindGroundHeight();
+
+	float GroundHeight = 0.0f;
+	bool bHasGroundHeight = false;
+};
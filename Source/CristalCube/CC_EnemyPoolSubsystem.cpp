@@ -0,0 +1,152 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CC_EnemyPoolSubsystem.h"
+#include "Characters/CC_EnemyCharacter.h"
+#include "Engine/World.h"
+#include "CC_Stats.h"
+
+void UCC_EnemyPoolSubsystem::Deinitialize()
+{
+	// Actors go with the world
+	Pools.Empty();
+	TotalPooled = 0;
+	SET_DWORD_STAT(STAT_CC_EnemyPoolSize, 0);
+
+	UE_LOG(LogTemp, Log, TEXT("Enemy pool deinitialized (Hits: %d, Misses: %d)"), HitCount, MissCount);
+
+	Super::Deinitialize();
+}
+
+UCC_EnemyPoolSubsystem* UCC_EnemyPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull))
+	{
+		return World->GetSubsystem<UCC_EnemyPoolSubsystem>();
+	}
+	return nullptr;
+}
+
+ACC_EnemyCharacter* UCC_EnemyPoolSubsystem::AcquireEnemy(TSubclassOf<ACC_EnemyCharacter> EnemyClass, const FVector& Location, const FRotator& Rotation)
+{
+	if (!EnemyClass)
+	{
+		return nullptr;
+	}
+
+	if (FCC_EnemyPoolList* Pool = Pools.Find(EnemyClass))
+	{
+		while (Pool->Enemies.Num() > 0)
+		{
+			ACC_EnemyCharacter* Enemy = Pool->Enemies.Pop(EAllowShrinking::No);
+			--TotalPooled;
+
+			// Destroyed while parked (level streaming, editor)
+			if (!IsValid(Enemy))
+			{
+				continue;
+			}
+
+			Enemy->SetPooled(false);
+			Enemy->ResetForReuse(Location, Rotation);
+			Enemy->ActivateEnemy();
+
+			++HitCount;
+			INC_DWORD_STAT(STAT_CC_EnemyPoolHits);
+			SET_DWORD_STAT(STAT_CC_EnemyPoolSize, TotalPooled);
+			return Enemy;
+		}
+	}
+
+	// Miss - a regular spawn, BeginPlay registers it
+	++MissCount;
+	INC_DWORD_STAT(STAT_CC_EnemyPoolMisses);
+	return SpawnEnemy(EnemyClass, Location, Rotation);
+}
+
+void UCC_EnemyPoolSubsystem::ReleaseEnemy(ACC_EnemyCharacter* Enemy)
+{
+	// Already parked (a second release, e.g. a death timer firing late)
+	if (!IsValid(Enemy) || Enemy->IsPooled())
+	{
+		return;
+	}
+
+	Enemy->DeactivateEnemy();
+
+	// End of this enemy's life - stale for everyone still holding the handle
+	Enemy->ReleaseEnemyHandle();
+
+	FCC_EnemyPoolList& Pool = Pools.FindOrAdd(Enemy->GetClass());
+	if (Pool.Enemies.Num() >= MaxPooledPerClass)
+	{
+		Enemy->Destroy();
+		return;
+	}
+
+	Enemy->SetPooled(true);
+	Pool.Enemies.Add(Enemy);
+	++TotalPooled;
+	SET_DWORD_STAT(STAT_CC_EnemyPoolSize, TotalPooled);
+}
+
+void UCC_EnemyPoolSubsystem::Prewarm(TSubclassOf<ACC_EnemyCharacter> EnemyClass, int32 Count, const FVector& Location)
+{
+	if (!EnemyClass || Count <= 0)
+	{
+		return;
+	}
+
+	const int32 Missing = FMath::Min(Count, MaxPooledPerClass) - GetPooledCount(EnemyClass);
+	for (int32 i = 0; i < Missing; ++i)
+	{
+		if (ACC_EnemyCharacter* Enemy = SpawnEnemy(EnemyClass, Location, FRotator::ZeroRotator))
+		{
+			ReleaseEnemy(Enemy);
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Enemy pool prewarmed %s: %d pooled"), *EnemyClass->GetName(), GetPooledCount(EnemyClass));
+}
+
+void UCC_EnemyPoolSubsystem::SuspendEnemy(ACC_EnemyCharacter* Enemy)
+{
+	if (IsValid(Enemy))
+	{
+		Enemy->DeactivateEnemy();
+	}
+}
+
+void UCC_EnemyPoolSubsystem::ResumeEnemy(ACC_EnemyCharacter* Enemy)
+{
+	if (IsValid(Enemy))
+	{
+		Enemy->ActivateEnemy();
+	}
+}
+
+int32 UCC_EnemyPoolSubsystem::GetPooledCount(TSubclassOf<ACC_EnemyCharacter> EnemyClass) const
+{
+	const FCC_EnemyPoolList* Pool = Pools.Find(EnemyClass);
+	return Pool ? Pool->Enemies.Num() : 0;
+}
+
+void UCC_EnemyPoolSubsystem::ResetStats()
+{
+	HitCount = 0;
+	MissCount = 0;
+}
+
+ACC_EnemyCharacter* UCC_EnemyPoolSubsystem::SpawnEnemy(TSubclassOf<ACC_EnemyCharacter> EnemyClass, const FVector& Location, const FRotator& Rotation) const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	return World->SpawnActor<ACC_EnemyCharacter>(EnemyClass, Location, Rotation, SpawnParams);
+}
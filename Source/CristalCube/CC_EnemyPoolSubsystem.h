@@ -0,0 +1,90 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CC_EnemyPoolSubsystem.generated.h"
+
+class ACC_EnemyCharacter;
+
+// Inactive enemies of one class, ready for reuse
+USTRUCT()
+struct FCC_EnemyPoolList
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<ACC_EnemyCharacter*> Enemies;
+};
+
+/**
+ * Per-class pool of ACC_EnemyCharacter actors
+ * Spawning, dying, dehydrating into proxies and cube freezing go through here instead of
+ * SpawnActor / Destroy: a released enemy is switched off (ACC_EnemyCharacter::DeactivateEnemy) and
+ * parked, an acquired one is reset (ResetForReuse) and switched back on.
+ */
+UCLASS()
+class CRISTALCUBE_API UCC_EnemyPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintPure, Category = "Enemy Pool", meta = (WorldContext = "WorldContextObject"))
+	static UCC_EnemyPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	//==========================================================================
+	// POOL
+	//==========================================================================
+
+	// Reset pooled enemy (hit) or a new one (miss), active and registered at Location
+	UFUNCTION(BlueprintCallable, Category = "Enemy Pool")
+	ACC_EnemyCharacter* AcquireEnemy(TSubclassOf<ACC_EnemyCharacter> EnemyClass, const FVector& Location, const FRotator& Rotation);
+
+	// Switch off and park for reuse (destroyed when the class is at MaxPooledPerClass)
+	UFUNCTION(BlueprintCallable, Category = "Enemy Pool")
+	void ReleaseEnemy(ACC_EnemyCharacter* Enemy);
+
+	// Spawn until Count enemies of the class wait in the pool (level start, before the first wave)
+	UFUNCTION(BlueprintCallable, Category = "Enemy Pool")
+	void Prewarm(TSubclassOf<ACC_EnemyCharacter> EnemyClass, int32 Count, const FVector& Location);
+
+	// Frozen cube: off without entering the pool, state kept
+	void SuspendEnemy(ACC_EnemyCharacter* Enemy);
+	void ResumeEnemy(ACC_EnemyCharacter* Enemy);
+
+	//==========================================================================
+	// STATS
+	//==========================================================================
+
+	UFUNCTION(BlueprintPure, Category = "Enemy Pool")
+	int32 GetPooledCount(TSubclassOf<ACC_EnemyCharacter> EnemyClass) const;
+
+	UFUNCTION(BlueprintPure, Category = "Enemy Pool")
+	int32 GetTotalPooledCount() const { return TotalPooled; }
+
+	UFUNCTION(BlueprintPure, Category = "Enemy Pool")
+	int32 GetHitCount() const { return HitCount; }
+
+	UFUNCTION(BlueprintPure, Category = "Enemy Pool")
+	int32 GetMissCount() const { return MissCount; }
+
+	UFUNCTION(BlueprintCallable, Category = "Enemy Pool")
+	void ResetStats();
+
+protected:
+	ACC_EnemyCharacter* SpawnEnemy(TSubclassOf<ACC_EnemyCharacter> EnemyClass, const FVector& Location, const FRotator& Rotation) const;
+
+	UPROPERTY()
+	TMap<UClass*, FCC_EnemyPoolList> Pools;
+
+	// Parked enemies beyond this are destroyed on release
+	UPROPERTY(EditAnywhere, Category = "Enemy Pool", meta = (ClampMin = "0"))
+	int32 MaxPooledPerClass = 256;
+
+	int32 TotalPooled = 0;
+	int32 HitCount = 0;
+	int32 MissCount = 0;
+};
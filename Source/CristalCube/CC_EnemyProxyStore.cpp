@@ -0,0 +1,138 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CC_EnemyProxyStore.h"
+#include "CC_FlowField.h"
+#include "CC_WorldWrap.h"
+#include "CC_Stats.h"
+#include "Characters/CC_EnemyCharacter.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+int32 FCC_EnemyProxyStore::FindOrAddArchetype(TSubclassOf<ACC_EnemyCharacter> Class)
+{
+    const int32 Existing = Archetypes.IndexOfByPredicate([Class](const FCC_EnemyProxyArchetype& Entry) { return Entry.Class == Class; });
+    if (Existing != INDEX_NONE)
+    {
+        return Existing;
+    }
+
+    FCC_EnemyProxyArchetype& NewArchetype = Archetypes.AddDefaulted_GetRef();
+    NewArchetype.Class = Class;
+
+    if (const ACC_EnemyCharacter* Defaults = Class ? Class->GetDefaultObject<ACC_EnemyCharacter>() : nullptr)
+    {
+        const float DetectionRange = Defaults->GetDetectionRange();
+        NewArchetype.MaxHealth = Defaults->GetMaxHealth();
+        NewArchetype.MoveSpeed = Defaults->GetCharacterMovement() ? Defaults->GetCharacterMovement()->MaxWalkSpeed : 0.0f;
+        NewArchetype.DetectionRangeSq = DetectionRange * DetectionRange;
+    }
+
+    return Archetypes.Num() - 1;
+}
+
+int32 FCC_EnemyProxyStore::Add(int32 ArchetypeIndex, const FVector& Location, float InYaw, float InHealth, ACC_EnemySpawner* InSource)
+{
+    X.Add(Location.X);
+    Y.Add(Location.Y);
+    Z.Add(Location.Z);
+    VelX.Add(0.0f);
+    VelY.Add(0.0f);
+    Yaw.Add(InYaw);
+    Health.Add(InHealth);
+    Archetype.Add(static_cast<uint16>(ArchetypeIndex));
+    bInRange.Add(0);
+    Source.Add(InSource);
+
+    return Num() - 1;
+}
+
+void FCC_EnemyProxyStore::RemoveAtSwap(int32 Index)
+{
+    X.RemoveAtSwap(Index, EAllowShrinking::No);
+    Y.RemoveAtSwap(Index, EAllowShrinking::No);
+    Z.RemoveAtSwap(Index, EAllowShrinking::No);
+    VelX.RemoveAtSwap(Index, EAllowShrinking::No);
+    VelY.RemoveAtSwap(Index, EAllowShrinking::No);
+    Yaw.RemoveAtSwap(Index, EAllowShrinking::No);
+    Health.RemoveAtSwap(Index, EAllowShrinking::No);
+    Archetype.RemoveAtSwap(Index, EAllowShrinking::No);
+    bInRange.RemoveAtSwap(Index, EAllowShrinking::No);
+    Source.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+void FCC_EnemyProxyStore::Reset()
+{
+    X.Reset();
+    Y.Reset();
+    Z.Reset();
+    VelX.Reset();
+    VelY.Reset();
+    Yaw.Reset();
+    Health.Reset();
+    Archetype.Reset();
+    bInRange.Reset();
+    Source.Reset();
+}
+
+int32 FCC_EnemyProxyStore::CountFromSource(const ACC_EnemySpawner* InSource) const
+{
+    int32 Count = 0;
+    for (const TWeakObjectPtr<ACC_EnemySpawner>& EntrySource : Source)
+    {
+        Count += EntrySource.Get() == InSource ? 1 : 0;
+    }
+    return Count;
+}
+
+void FCC_EnemyProxyStore::GetEntriesInRadius(const FVector& Location, float Radius, const FCC_WorldWrap& Wrap, TArray<int32>& OutEntries) const
+{
+    const float RadiusSq = Radius * Radius;
+    for (int32 Index = 0; Index < Num(); ++Index)
+    {
+        if (Wrap.DistSquared(Location, GetLocation(Index)) <= RadiusSq)
+        {
+            OutEntries.Add(Index);
+        }
+    }
+}
+
+void FCC_EnemyProxyStore::UpdateMovement(FCC_EnemyProxyStore& Store, const FVector& Goal, const FCC_WorldWrap& Wrap,
+    const FCC_FlowField* FlowField, float HydrationRadius, float DeltaSeconds, int32 MinBatchSize, EParallelForFlags Flags)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(FCC_EnemyProxyStore::UpdateMovement);
+    SCOPE_CYCLE_COUNTER(STAT_CC_AIProxyMovement);
+
+    const float HydrationRadiusSq = HydrationRadius * HydrationRadius;
+    const TArray<FCC_EnemyProxyArchetype>& Archetypes = Store.Archetypes;
+
+    ParallelFor(TEXT("CC_EnemyProxies"), Store.Num(), MinBatchSize, [&Store, &Goal, &Wrap, FlowField, HydrationRadiusSq, &Archetypes, DeltaSeconds](int32 i)
+    {
+        const FCC_EnemyProxyArchetype& EntryArchetype = Archetypes[Store.Archetype[i]];
+        const FVector Location(Store.X[i], Store.Y[i], Store.Z[i]);
+        const FVector Delta = Wrap.MinimumImageDelta(Location, Goal);
+        const float PlanarSq = Delta.X * Delta.X + Delta.Y * Delta.Y;
+        const float DistSq = PlanarSq + Delta.Z * Delta.Z;
+
+        // Same rule as the actor steering: only inside the detection range
+        FVector2D Direction = FVector2D::ZeroVector;
+        if (DistSq <= EntryArchetype.DetectionRangeSq && PlanarSq > KINDA_SMALL_NUMBER)
+        {
+            if (!FlowField || !FlowField->SampleDirection(Location, Direction))
+            {
+                const float InvLength = FMath::InvSqrt(PlanarSq);
+                Direction = FVector2D(Delta.X * InvLength, Delta.Y * InvLength);
+            }
+
+            Store.Yaw[i] = FMath::RadiansToDegrees(FMath::Atan2(Direction.Y, Direction.X));
+        }
+
+        Store.VelX[i] = Direction.X * EntryArchetype.MoveSpeed;
+        Store.VelY[i] = Direction.Y * EntryArchetype.MoveSpeed;
+
+        const FVector Moved = Wrap.Fold(FVector(Store.X[i] + Store.VelX[i] * DeltaSeconds, Store.Y[i] + Store.VelY[i] * DeltaSeconds, Store.Z[i]));
+        Store.X[i] = Moved.X;
+        Store.Y[i] = Moved.Y;
+
+        Store.bInRange[i] = DistSq <= HydrationRadiusSq ? 1 : 0;
+    }, Flags);
+}
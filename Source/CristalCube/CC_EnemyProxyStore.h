@@ -0,0 +1,92 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SubclassOf.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "Async/ParallelFor.h"
+
+class ACC_EnemyCharacter;
+class ACC_EnemySpawner;
+class FCC_FlowField;
+struct FCC_WorldWrap;
+
+// Per-class data shared by every proxy of that class (read from the class defaults once)
+struct FCC_EnemyProxyArchetype
+{
+    TSubclassOf<ACC_EnemyCharacter> Class;
+    float MaxHealth = 0.0f;
+    float MoveSpeed = 0.0f;
+    float DetectionRangeSq = 0.0f;
+};
+
+/**
+ * Far enemies without an actor
+ * One entry per enemy in structure-of-arrays columns (transform, velocity, health, archetype),
+ * updated by whole-column passes - the entity/fragment/processor layout of MassEntity, kept inside
+ * the module. UCC_AIManager hydrates entries into ACC_EnemyCharacter actors near the player and
+ * dehydrates sleeping actors back into entries.
+ */
+class CRISTALCUBE_API FCC_EnemyProxyStore
+{
+public:
+    //==========================================================================
+    // FRAGMENTS (dense, index = entry; a removal swaps the last entry in)
+    //==========================================================================
+
+    TArray<float> X;
+    TArray<float> Y;
+    TArray<float> Z;
+    TArray<float> VelX;
+    TArray<float> VelY;
+    TArray<float> Yaw;
+    TArray<float> Health;
+    TArray<uint16> Archetype;
+
+    // Written by UpdateMovement: 1 = within the hydration radius this frame
+    TArray<uint8> bInRange;
+
+    // Spawner that owns the enemy (game thread only)
+    TArray<TWeakObjectPtr<ACC_EnemySpawner>> Source;
+
+    int32 Num() const { return X.Num(); }
+
+    //==========================================================================
+    // ENTRIES
+    //==========================================================================
+
+    // Archetype index for the class (added from its class defaults on first use)
+    int32 FindOrAddArchetype(TSubclassOf<ACC_EnemyCharacter> Class);
+
+    const FCC_EnemyProxyArchetype& GetArchetype(int32 ArchetypeIndex) const { return Archetypes[ArchetypeIndex]; }
+
+    // @return Entry index (valid until the next removal)
+    int32 Add(int32 ArchetypeIndex, const FVector& Location, float InYaw, float InHealth, ACC_EnemySpawner* InSource);
+
+    void RemoveAtSwap(int32 Index);
+
+    // Entries only - archetypes stay cached
+    void Reset();
+
+    FVector GetLocation(int32 Index) const { return FVector(X[Index], Y[Index], Z[Index]); }
+
+    int32 CountFromSource(const ACC_EnemySpawner* InSource) const;
+
+    // Entries within Radius of Location (closest image when wrapped)
+    void GetEntriesInRadius(const FVector& Location, float Radius, const FCC_WorldWrap& Wrap, TArray<int32>& OutEntries) const;
+
+    //==========================================================================
+    // PROCESSORS (column passes, no actor access)
+    //==========================================================================
+
+    /**
+     * Chase the goal like an actor in range would (flow field or straight), fold into the wrap domain
+     * and flag entries within HydrationRadius
+     */
+    static void UpdateMovement(FCC_EnemyProxyStore& Store, const FVector& Goal, const FCC_WorldWrap& Wrap,
+        const FCC_FlowField* FlowField, float HydrationRadius, float DeltaSeconds, int32 MinBatchSize, EParallelForFlags Flags);
+
+private:
+    TArray<FCC_EnemyProxyArchetype> Archetypes;
+};
@@ -0,0 +1,38 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CC_EnemyQueryBatch.h"
+
+FCC_EnemyQueryRequest FCC_EnemyQueryRequest::Nearest(const FVector& Origin, float Radius, int32 Count)
+{
+    FCC_EnemyQueryRequest Request;
+    Request.Shape = FCC_EnemyShapeQuery::MakeSphere(Origin, Radius);
+    Request.Select = ECC_EnemyQuerySelect::Nearest;
+    Request.MaxResults = FMath::Max(1, Count);
+    return Request;
+}
+
+FCC_EnemyQueryRequest FCC_EnemyQueryRequest::CachedNearest(const FVector& Origin, float Radius)
+{
+    FCC_EnemyQueryRequest Request = Nearest(Origin, Radius, 1);
+    Request.bUseTargetCache = true;
+    return Request;
+}
+
+FCC_EnemyQueryRequest FCC_EnemyQueryRequest::Random(const FVector& Origin, float Radius, int32 Count)
+{
+    FCC_EnemyQueryRequest Request;
+    Request.Shape = FCC_EnemyShapeQuery::MakeSphere(Origin, Radius);
+    Request.Select = ECC_EnemyQuerySelect::Random;
+    Request.MaxResults = FMath::Max(1, Count);
+    return Request;
+}
+
+FCC_EnemyQueryRequest FCC_EnemyQueryRequest::InShape(const FCC_EnemyShapeQuery& Shape, int32 MaxResults)
+{
+    FCC_EnemyQueryRequest Request;
+    Request.Shape = Shape;
+    Request.Select = ECC_EnemyQuerySelect::All;
+    Request.MaxResults = FMath::Max(0, MaxResults);
+    return Request;
+}
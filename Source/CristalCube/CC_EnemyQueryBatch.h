@@ -0,0 +1,97 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CC_EnemyQueryKernels.h"
+
+// How the enemies inside the shape are picked
+enum class ECC_EnemyQuerySelect : uint8
+{
+    All,        // every enemy in the shape (MaxResults > 0 truncates)
+    Nearest,    // MaxResults closest to the shape origin, nearest first
+    Random      // MaxResults random enemies from the shape
+};
+
+/**
+ * Targeting query descriptor for ACC_EnemyManager::SubmitQuery
+ * Every query submitted during a frame is resolved in one pass over the enemy grid.
+ */
+struct CRISTALCUBE_API FCC_EnemyQueryRequest
+{
+    FCC_EnemyShapeQuery Shape;
+
+    ECC_EnemyQuerySelect Select = ECC_EnemyQuerySelect::All;
+
+    // 0 = no limit (All only)
+    int32 MaxResults = 0;
+
+    // Never returned (already hit, chain history...)
+    TArray<const AActor*> ExcludeActors;
+
+    // Nearest (1 result) only - reuse the requester's last target while it is still valid
+    bool bUseTargetCache = false;
+
+    static FCC_EnemyQueryRequest Nearest(const FVector& Origin, float Radius, int32 Count = 1);
+
+    // Single nearest target through the requester's target cache (auto-aim)
+    static FCC_EnemyQueryRequest CachedNearest(const FVector& Origin, float Radius);
+    static FCC_EnemyQueryRequest Random(const FVector& Origin, float Radius, int32 Count);
+    static FCC_EnemyQueryRequest InShape(const FCC_EnemyShapeQuery& Shape, int32 MaxResults = 0);
+};
+
+// Identifies a submitted query (used to cancel it before it resolves)
+struct CRISTALCUBE_API FCC_EnemyQueryHandle
+{
+    int32 Id = 0;
+
+    bool IsValid() const { return Id != 0; }
+    void Invalidate() { Id = 0; }
+};
+
+// Called once the batch resolves (same frame, after all actor ticks and timers)
+using FCC_EnemyQueryCallback = TFunction<void(const TArray<AActor*>& Enemies)>;
+
+// Query waiting in the manager's batch
+struct FCC_PendingEnemyQuery
+{
+    int32 Id = 0;
+
+    // Callback is skipped if the requester was destroyed meanwhile
+    TWeakObjectPtr<const UObject> Requester;
+
+    FCC_EnemyQueryRequest Request;
+    FCC_EnemyQueryCallback OnResolved;
+
+    // Served from the target cache - skipped by the grid pass
+    bool bCacheHit = false;
+
+    // Gathered entries / results live in the manager's pooled batch buffers
+};
+
+// One wrap image of a pending query (just the query itself when the world does not wrap)
+struct FCC_PendingQueryImage
+{
+    // Index into the resolving batch
+    int32 Slot = 0;
+
+    // Query shape moved by the image offset
+    FCC_EnemyShapeQuery Shape;
+
+    // Grid cells covered by the shape's bounding rect
+    FIntPoint MinCell = FIntPoint::ZeroValue;
+    FIntPoint MaxCell = FIntPoint::ZeroValue;
+};
+
+// Last target handed to one querier (weapon, searching component...)
+struct FCC_TargetCacheEntry
+{
+    TWeakObjectPtr<AActor> Target;
+
+    // Querier location and world time of the search that found Target
+    FVector QuerierLocation = FVector::ZeroVector;
+    double SearchTime = 0.0;
+
+    // Manager registration generation at search time
+    uint32 Generation = 0;
+};
@@ -0,0 +1,293 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CC_EnemyQueryKernels.h"
+#include "CC_Stats.h"
+
+//==============================================================================
+// QUERY SETUP
+//==============================================================================
+
+FCC_EnemyShapeQuery FCC_EnemyShapeQuery::MakeSphere(const FVector& Center, float Radius)
+{
+    FCC_EnemyShapeQuery Query;
+    Query.Shape = ECC_EnemyQueryShape::Sphere;
+    Query.Origin = FVector3f(Center);
+    Query.RadiusSq = Radius * Radius;
+    Query.BoundingRadius = Radius;
+    return Query;
+}
+
+FCC_EnemyShapeQuery FCC_EnemyShapeQuery::MakeCone(const FVector& Origin, const FVector& Direction, float Range, float HalfAngle)
+{
+    FCC_EnemyShapeQuery Query;
+    Query.Shape = ECC_EnemyQueryShape::Cone;
+    Query.Origin = FVector3f(Origin);
+    Query.RadiusSq = Range * Range;
+    Query.BoundingRadius = Range;
+    Query.Direction = FVector3f(Direction.GetSafeNormal());
+    Query.CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(HalfAngle, 0.0f, 180.0f)));
+    return Query;
+}
+
+FCC_EnemyShapeQuery FCC_EnemyShapeQuery::MakeBox(const FVector& Center, const FVector& HalfExtents, const FRotator& Rotation)
+{
+    const FRotationMatrix RotationMatrix(Rotation);
+
+    FCC_EnemyShapeQuery Query;
+    Query.Shape = ECC_EnemyQueryShape::Box;
+    Query.Origin = FVector3f(Center);
+    Query.BoundingRadius = HalfExtents.Size();
+    Query.AxisX = FVector3f(RotationMatrix.GetUnitAxis(EAxis::X));
+    Query.AxisY = FVector3f(RotationMatrix.GetUnitAxis(EAxis::Y));
+    Query.AxisZ = FVector3f(RotationMatrix.GetUnitAxis(EAxis::Z));
+    Query.HalfExtents = FVector3f(HalfExtents);
+    return Query;
+}
+
+//==============================================================================
+// KERNELS
+//==============================================================================
+
+void FCC_EnemyQueryKernels::Filter(const FCC_EnemySnapshot& Snapshot, int32 StartEntry, int32 EndEntry,
+    const FCC_EnemyShapeQuery& Query, TArray<int32>& OutEntries, bool bVectorized)
+{
+    INC_DWORD_STAT_BY(STAT_CC_QueryCandidates, FMath::Max(EndEntry - StartEntry, 0));
+
+    if (bVectorized)
+    {
+        FilterVector(Snapshot, StartEntry, EndEntry, Query, OutEntries);
+    }
+    else
+    {
+        FilterScalar(Snapshot, StartEntry, EndEntry, Query, OutEntries);
+    }
+}
+
+// NOTE: The scalar math below mirrors the vector version operation by operation
+// (same evaluation order) so both return identical entries - see ACC_SpatialQueryTester.
+void FCC_EnemyQueryKernels::FilterScalar(const FCC_EnemySnapshot& Snapshot, int32 StartEntry, int32 EndEntry,
+    const FCC_EnemyShapeQuery& Query, TArray<int32>& OutEntries)
+{
+    const float* RESTRICT PosX = Snapshot.X.GetData();
+    const float* RESTRICT PosY = Snapshot.Y.GetData();
+    const float* RESTRICT PosZ = Snapshot.Z.GetData();
+    const uint8* RESTRICT Alive = Snapshot.Alive.GetData();
+
+    for (int32 EntryIndex = StartEntry; EntryIndex < EndEntry; ++EntryIndex)
+    {
+        if (!Alive[EntryIndex])
+        {
+            continue;
+        }
+
+        const float DX = PosX[EntryIndex] - Query.Origin.X;
+        const float DY = PosY[EntryIndex] - Query.Origin.Y;
+        const float DZ = PosZ[EntryIndex] - Query.Origin.Z;
+
+        bool bInside = false;
+
+        switch (Query.Shape)
+        {
+        case ECC_EnemyQueryShape::Sphere:
+        {
+            const float DistSq = DX * DX + DY * DY + DZ * DZ;
+            bInside = DistSq <= Query.RadiusSq;
+            break;
+        }
+        case ECC_EnemyQueryShape::Cone:
+        {
+            // angle <= HalfAngle  <=>  dot(Dir, D) >= cos(HalfAngle) * |D|
+            const float DistSq = DX * DX + DY * DY + DZ * DZ;
+            const float Dot = DX * Query.Direction.X + DY * Query.Direction.Y + DZ * Query.Direction.Z;
+            const float Dist = FMath::Sqrt(DistSq);
+            bInside = DistSq <= Query.RadiusSq && Dot >= Query.CosHalfAngle * Dist;
+            break;
+        }
+        case ECC_EnemyQueryShape::Box:
+        {
+            const float LX = DX * Query.AxisX.X + DY * Query.AxisX.Y + DZ * Query.AxisX.Z;
+            const float LY = DX * Query.AxisY.X + DY * Query.AxisY.Y + DZ * Query.AxisY.Z;
+            const float LZ = DX * Query.AxisZ.X + DY * Query.AxisZ.Y + DZ * Query.AxisZ.Z;
+            bInside = FMath::Abs(LX) <= Query.HalfExtents.X &&
+                FMath::Abs(LY) <= Query.HalfExtents.Y &&
+                FMath::Abs(LZ) <= Query.HalfExtents.Z;
+            break;
+        }
+        }
+
+        if (bInside)
+        {
+            OutEntries.Add(EntryIndex);
+        }
+    }
+}
+
+namespace
+{
+    // (AX * BX + AY * BY) + AZ * BZ, same order as the scalar reference
+    FORCEINLINE VectorRegister4Float VectorDot3Lanes(
+        const VectorRegister4Float& AX, const VectorRegister4Float& AY, const VectorRegister4Float& AZ,
+        const VectorRegister4Float& BX, const VectorRegister4Float& BY, const VectorRegister4Float& BZ)
+    {
+        return VectorAdd(VectorAdd(VectorMultiply(AX, BX), VectorMultiply(AY, BY)), VectorMultiply(AZ, BZ));
+    }
+}
+
+void FCC_EnemyQueryKernels::FilterVector(const FCC_EnemySnapshot& Snapshot, int32 StartEntry, int32 EndEntry,
+    const FCC_EnemyShapeQuery& Query, TArray<int32>& OutEntries)
+{
+    const float* RESTRICT PosX = Snapshot.X.GetData();
+    const float* RESTRICT PosY = Snapshot.Y.GetData();
+    const float* RESTRICT PosZ = Snapshot.Z.GetData();
+    const uint8* RESTRICT Alive = Snapshot.Alive.GetData();
+
+    const VectorRegister4Float OriginX = VectorSetFloat1(Query.Origin.X);
+    const VectorRegister4Float OriginY = VectorSetFloat1(Query.Origin.Y);
+    const VectorRegister4Float OriginZ = VectorSetFloat1(Query.Origin.Z);
+    const VectorRegister4Float RadiusSq = VectorSetFloat1(Query.RadiusSq);
+
+    const VectorRegister4Float DirX = VectorSetFloat1(Query.Direction.X);
+    const VectorRegister4Float DirY = VectorSetFloat1(Query.Direction.Y);
+    const VectorRegister4Float DirZ = VectorSetFloat1(Query.Direction.Z);
+    const VectorRegister4Float CosHalfAngle = VectorSetFloat1(Query.CosHalfAngle);
+
+    const VectorRegister4Float AxisXX = VectorSetFloat1(Query.AxisX.X);
+    const VectorRegister4Float AxisXY = VectorSetFloat1(Query.AxisX.Y);
+    const VectorRegister4Float AxisXZ = VectorSetFloat1(Query.AxisX.Z);
+    const VectorRegister4Float AxisYX = VectorSetFloat1(Query.AxisY.X);
+    const VectorRegister4Float AxisYY = VectorSetFloat1(Query.AxisY.Y);
+    const VectorRegister4Float AxisYZ = VectorSetFloat1(Query.AxisY.Z);
+    const VectorRegister4Float AxisZX = VectorSetFloat1(Query.AxisZ.X);
+    const VectorRegister4Float AxisZY = VectorSetFloat1(Query.AxisZ.Y);
+    const VectorRegister4Float AxisZZ = VectorSetFloat1(Query.AxisZ.Z);
+    const VectorRegister4Float HalfX = VectorSetFloat1(Query.HalfExtents.X);
+    const VectorRegister4Float HalfY = VectorSetFloat1(Query.HalfExtents.Y);
+    const VectorRegister4Float HalfZ = VectorSetFloat1(Query.HalfExtents.Z);
+
+    int32 EntryIndex = StartEntry;
+
+    for (; EntryIndex + 4 <= EndEntry; EntryIndex += 4)
+    {
+        const VectorRegister4Float DX = VectorSubtract(VectorLoad(PosX + EntryIndex), OriginX);
+        const VectorRegister4Float DY = VectorSubtract(VectorLoad(PosY + EntryIndex), OriginY);
+        const VectorRegister4Float DZ = VectorSubtract(VectorLoad(PosZ + EntryIndex), OriginZ);
+
+        VectorRegister4Float Mask;
+
+        switch (Query.Shape)
+        {
+        case ECC_EnemyQueryShape::Cone:
+        {
+            const VectorRegister4Float DistSq = VectorDot3Lanes(DX, DY, DZ, DX, DY, DZ);
+            const VectorRegister4Float Dot = VectorDot3Lanes(DX, DY, DZ, DirX, DirY, DirZ);
+            const VectorRegister4Float Dist = VectorSqrt(DistSq);
+            Mask = VectorBitwiseAnd(
+                VectorCompareLE(DistSq, RadiusSq),
+                VectorCompareGE(Dot, VectorMultiply(CosHalfAngle, Dist)));
+            break;
+        }
+        case ECC_EnemyQueryShape::Box:
+        {
+            const VectorRegister4Float LX = VectorDot3Lanes(DX, DY, DZ, AxisXX, AxisXY, AxisXZ);
+            const VectorRegister4Float LY = VectorDot3Lanes(DX, DY, DZ, AxisYX, AxisYY, AxisYZ);
+            const VectorRegister4Float LZ = VectorDot3Lanes(DX, DY, DZ, AxisZX, AxisZY, AxisZZ);
+            Mask = VectorBitwiseAnd(
+                VectorBitwiseAnd(VectorCompareLE(VectorAbs(LX), HalfX), VectorCompareLE(VectorAbs(LY), HalfY)),
+                VectorCompareLE(VectorAbs(LZ), HalfZ));
+            break;
+        }
+        case ECC_EnemyQueryShape::Sphere:
+        default:
+        {
+            const VectorRegister4Float DistSq = VectorDot3Lanes(DX, DY, DZ, DX, DY, DZ);
+            Mask = VectorCompareLE(DistSq, RadiusSq);
+            break;
+        }
+        }
+
+        // Compact passing lanes
+        uint32 LaneBits = (uint32)VectorMaskBits(Mask);
+        while (LaneBits)
+        {
+            const int32 Lane = (int32)FMath::CountTrailingZeros(LaneBits);
+            LaneBits &= LaneBits - 1;
+
+            if (Alive[EntryIndex + Lane])
+            {
+                OutEntries.Add(EntryIndex + Lane);
+            }
+        }
+    }
+
+    // Tail (< 4 entries)
+    if (EntryIndex < EndEntry)
+    {
+        FilterScalar(Snapshot, EntryIndex, EndEntry, Query, OutEntries);
+    }
+}
+
+//==============================================================================
+// SELECTION
+//==============================================================================
+
+void FCC_EnemyQueryKernels::SelectNearest(const FCC_EnemySnapshot& Snapshot, const FVector& Origin, int32 K, TArray<int32>& InOutEntries,
+    const FCC_WorldWrap* Wrap)
+{
+    if (K <= 0)
+    {
+        InOutEntries.Reset();
+        return;
+    }
+
+    // Largest distance on top - replaced whenever a closer entry shows up
+    auto HeapPredicate = [](const FCC_NearestEntry& A, const FCC_NearestEntry& B) { return A.DistSq > B.DistSq; };
+
+    TArray<FCC_NearestEntry, TInlineAllocator<32>> Heap;
+
+    for (int32 EntryIndex : InOutEntries)
+    {
+        const float DistSq = Wrap && Wrap->IsEnabled()
+            ? Wrap->DistSquared(Origin, Snapshot.GetLocation(EntryIndex))
+            : Snapshot.DistSquared(EntryIndex, Origin);
+
+        if (Heap.Num() < K)
+        {
+            Heap.HeapPush(FCC_NearestEntry{ DistSq, EntryIndex }, HeapPredicate);
+        }
+        else if (DistSq < Heap.HeapTop().DistSq)
+        {
+            Heap.HeapPopDiscard(HeapPredicate, EAllowShrinking::No);
+            Heap.HeapPush(FCC_NearestEntry{ DistSq, EntryIndex }, HeapPredicate);
+        }
+    }
+
+    Heap.Sort([](const FCC_NearestEntry& A, const FCC_NearestEntry& B) { return A.DistSq < B.DistSq; });
+
+    InOutEntries.Reset();
+    for (const FCC_NearestEntry& Nearest : Heap)
+    {
+        InOutEntries.Add(Nearest.EntryIndex);
+    }
+}
+
+void FCC_EnemyQueryKernels::RemoveDuplicateEntries(TArray<int32>& InOutEntries)
+{
+    if (InOutEntries.Num() < 2)
+    {
+        return;
+    }
+
+    InOutEntries.Sort();
+
+    int32 WriteIndex = 1;
+    for (int32 ReadIndex = 1; ReadIndex < InOutEntries.Num(); ++ReadIndex)
+    {
+        if (InOutEntries[ReadIndex] != InOutEntries[WriteIndex - 1])
+        {
+            InOutEntries[WriteIndex++] = InOutEntries[ReadIndex];
+        }
+    }
+
+    InOutEntries.SetNum(WriteIndex, EAllowShrinking::No);
+}
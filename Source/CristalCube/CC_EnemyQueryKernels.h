@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CC_EnemySnapshot.h"
+#include "CC_WorldWrap.h"
+
+enum class ECC_EnemyQueryShape : uint8
+{
+    Sphere,
+    Cone,
+    Box
+};
+
+/**
+ * Prepared shape query (float, precomputed once per query)
+ * Cone compares against cos(half angle) instead of calling Acos per enemy,
+ * box stores the rotated axes instead of inverse-transforming per enemy.
+ */
+struct CRISTALCUBE_API FCC_EnemyShapeQuery
+{
+    ECC_EnemyQueryShape Shape = ECC_EnemyQueryShape::Sphere;
+
+    FVector3f Origin = FVector3f::ZeroVector;
+
+    // Sphere radius / cone range, squared
+    float RadiusSq = 0.0f;
+
+    // Radius of a sphere around Origin containing the whole shape (candidate cell walk)
+    float BoundingRadius = 0.0f;
+
+    // Cone
+    FVector3f Direction = FVector3f::ForwardVector;
+    float CosHalfAngle = 1.0f;
+
+    // Box
+    FVector3f AxisX = FVector3f::ForwardVector;
+    FVector3f AxisY = FVector3f::RightVector;
+    FVector3f AxisZ = FVector3f::UpVector;
+    FVector3f HalfExtents = FVector3f::ZeroVector;
+
+    static FCC_EnemyShapeQuery MakeSphere(const FVector& Center, float Radius);
+
+    // HalfAngle in degrees, Direction does not need to be normalized
+    static FCC_EnemyShapeQuery MakeCone(const FVector& Origin, const FVector& Direction, float Range, float HalfAngle);
+
+    static FCC_EnemyShapeQuery MakeBox(const FVector& Center, const FVector& HalfExtents, const FRotator& Rotation);
+};
+
+/**
+ * Shape filters over a contiguous snapshot range
+ * Scalar versions are the reference, vector versions process 4 enemies per iteration
+ * (VectorRegister4Float, SSE/NEON) and must return exactly the same entries.
+ */
+struct CRISTALCUBE_API FCC_EnemyQueryKernels
+{
+    // Append alive entries in [StartEntry, EndEntry) that are inside Query
+    static void Filter(const FCC_EnemySnapshot& Snapshot, int32 StartEntry, int32 EndEntry,
+        const FCC_EnemyShapeQuery& Query, TArray<int32>& OutEntries, bool bVectorized = true);
+
+    static void FilterScalar(const FCC_EnemySnapshot& Snapshot, int32 StartEntry, int32 EndEntry,
+        const FCC_EnemyShapeQuery& Query, TArray<int32>& OutEntries);
+
+    static void FilterVector(const FCC_EnemySnapshot& Snapshot, int32 StartEntry, int32 EndEntry,
+        const FCC_EnemyShapeQuery& Query, TArray<int32>& OutEntries);
+
+    // Keep the K entries closest to Origin, nearest first (bounded max-heap, no full sort)
+    // Wrap (optional) switches to minimum-image distance
+    static void SelectNearest(const FCC_EnemySnapshot& Snapshot, const FVector& Origin, int32 K, TArray<int32>& InOutEntries,
+        const FCC_WorldWrap* Wrap = nullptr);
+
+    // Sort + drop repeated entries (queries that saw an enemy through two wrap images)
+    static void RemoveDuplicateEntries(TArray<int32>& InOutEntries);
+};
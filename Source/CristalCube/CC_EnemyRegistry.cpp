@@ -0,0 +1,182 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CC_EnemyRegistry.h"
+#include "Characters/CC_EnemyCharacter.h"
+#include "Engine/World.h"
+#include "CC_Stats.h"
+
+//==============================================================================
+// FCC_EnemyHandleSet
+//==============================================================================
+
+bool FCC_EnemyHandleSet::Add(const FCC_EnemyHandle& Handle)
+{
+	if (!Handle.IsSet())
+	{
+		return false;
+	}
+
+	if (Handle.Index >= Sparse.Num())
+	{
+		const int32 OldNum = Sparse.Num();
+		Sparse.SetNumUninitialized(Handle.Index + 1);
+		for (int32 i = OldNum; i < Sparse.Num(); ++i)
+		{
+			Sparse[i] = INDEX_NONE;
+		}
+	}
+
+	const int32 DenseIndex = Sparse[Handle.Index];
+	if (DenseIndex != INDEX_NONE)
+	{
+		if (Dense[DenseIndex] == Handle)
+		{
+			return false;
+		}
+
+		// Stale handle from the slot's previous enemy - the new life takes its place
+		Dense[DenseIndex] = Handle;
+		return true;
+	}
+
+	Sparse[Handle.Index] = Dense.Add(Handle);
+	return true;
+}
+
+int32 FCC_EnemyHandleSet::Remove(const FCC_EnemyHandle& Handle)
+{
+	const int32 DenseIndex = IndexOf(Handle);
+	if (DenseIndex != INDEX_NONE)
+	{
+		RemoveAt(DenseIndex);
+	}
+	return DenseIndex;
+}
+
+void FCC_EnemyHandleSet::RemoveAt(int32 DenseIndex)
+{
+	Sparse[Dense[DenseIndex].Index] = INDEX_NONE;
+
+	Dense.RemoveAtSwap(DenseIndex, EAllowShrinking::No);
+	if (Dense.IsValidIndex(DenseIndex))
+	{
+		Sparse[Dense[DenseIndex].Index] = DenseIndex;
+	}
+}
+
+int32 FCC_EnemyHandleSet::RemoveStale(const UCC_EnemyRegistry& Registry)
+{
+	int32 Removed = 0;
+	for (int32 i = Dense.Num() - 1; i >= 0; --i)
+	{
+		if (!Registry.IsValidHandle(Dense[i]))
+		{
+			RemoveAt(i);
+			++Removed;
+		}
+	}
+	return Removed;
+}
+
+void FCC_EnemyHandleSet::Reset()
+{
+	Dense.Reset();
+	Sparse.Reset();
+}
+
+//==============================================================================
+// UCC_EnemyRegistry
+//==============================================================================
+
+void UCC_EnemyRegistry::Deinitialize()
+{
+	Slots.Empty();
+	FreeSlots.Empty();
+	DenseHandles.Empty();
+	DenseActors.Empty();
+	DenseAlive.Empty();
+	DenseRadii.Empty();
+	SET_DWORD_STAT(STAT_CC_RegisteredEnemies, 0);
+
+	Super::Deinitialize();
+}
+
+UCC_EnemyRegistry* UCC_EnemyRegistry::Get(const UObject* WorldContextObject)
+{
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull))
+	{
+		return World->GetSubsystem<UCC_EnemyRegistry>();
+	}
+	return nullptr;
+}
+
+FCC_EnemyHandle UCC_EnemyRegistry::Register(ACC_EnemyCharacter* Enemy)
+{
+	if (!Enemy)
+	{
+		return FCC_EnemyHandle();
+	}
+
+	int32 SlotIndex;
+	if (FreeSlots.Num() > 0)
+	{
+		SlotIndex = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		SlotIndex = Slots.AddDefaulted();
+	}
+
+	FSlot& Slot = Slots[SlotIndex];
+	Slot.DenseIndex = DenseHandles.Num();
+
+	FCC_EnemyHandle Handle;
+	Handle.Index = SlotIndex;
+	Handle.Generation = Slot.Generation;
+
+	DenseHandles.Add(Handle);
+	DenseActors.Add(Enemy);
+	DenseAlive.Add(1);
+	DenseRadii.Add(Enemy->GetSimpleCollisionRadius());
+
+	SET_DWORD_STAT(STAT_CC_RegisteredEnemies, DenseHandles.Num());
+	return Handle;
+}
+
+void UCC_EnemyRegistry::Unregister(const FCC_EnemyHandle& Handle)
+{
+	const int32 DenseIndex = GetDenseIndex(Handle);
+	if (DenseIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Every copy of the handle goes stale here
+	FSlot& Slot = Slots[Handle.Index];
+	++Slot.Generation;
+	Slot.DenseIndex = INDEX_NONE;
+	FreeSlots.Add(Handle.Index);
+
+	// Swap-and-pop, the last enemy's slot follows it
+	DenseHandles.RemoveAtSwap(DenseIndex, EAllowShrinking::No);
+	DenseActors.RemoveAtSwap(DenseIndex, EAllowShrinking::No);
+	DenseAlive.RemoveAtSwap(DenseIndex, EAllowShrinking::No);
+	DenseRadii.RemoveAtSwap(DenseIndex, EAllowShrinking::No);
+
+	if (DenseHandles.IsValidIndex(DenseIndex))
+	{
+		Slots[DenseHandles[DenseIndex].Index].DenseIndex = DenseIndex;
+	}
+
+	SET_DWORD_STAT(STAT_CC_RegisteredEnemies, DenseHandles.Num());
+}
+
+void UCC_EnemyRegistry::MarkDead(const FCC_EnemyHandle& Handle)
+{
+	const int32 DenseIndex = GetDenseIndex(Handle);
+	if (DenseIndex != INDEX_NONE)
+	{
+		DenseAlive[DenseIndex] = 0;
+	}
+}
@@ -0,0 +1,176 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CC_EnemyRegistry.generated.h"
+
+class ACC_EnemyCharacter;
+class UCC_EnemyRegistry;
+
+/**
+ * Generational reference to one enemy life
+ * Index picks the registry slot, Generation must match the slot's - a slot is reused for the next
+ * enemy with a bumped generation, so a handle kept past death/pooling simply stops resolving.
+ */
+USTRUCT(BlueprintType)
+struct FCC_EnemyHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Index = INDEX_NONE;
+
+	UPROPERTY()
+	int32 Generation = 0;
+
+	bool IsSet() const { return Index != INDEX_NONE; }
+	void Reset() { *this = FCC_EnemyHandle(); }
+
+	bool operator==(const FCC_EnemyHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+	bool operator!=(const FCC_EnemyHandle& Other) const { return !(*this == Other); }
+
+	friend uint32 GetTypeHash(const FCC_EnemyHandle& Handle)
+	{
+		return HashCombine(::GetTypeHash(Handle.Index), ::GetTypeHash(Handle.Generation));
+	}
+};
+
+/**
+ * Set of enemy handles with O(1) add / remove / contains
+ * Dense handle array for iteration plus a sparse index by registry slot - what every system that
+ * tracks "its" enemies (spawner, cube, tile, managers) keeps instead of a TArray of actor pointers.
+ * Removal swaps the last handle in; RemoveAt exposes the dense index for parallel arrays.
+ */
+struct CRISTALCUBE_API FCC_EnemyHandleSet
+{
+	// False when already in the set (an older life in the same slot is replaced)
+	bool Add(const FCC_EnemyHandle& Handle);
+
+	// Dense index the handle was at (the last handle now lives there), INDEX_NONE if not in the set
+	int32 Remove(const FCC_EnemyHandle& Handle);
+
+	void RemoveAt(int32 DenseIndex);
+
+	bool Contains(const FCC_EnemyHandle& Handle) const { return IndexOf(Handle) != INDEX_NONE; }
+
+	int32 IndexOf(const FCC_EnemyHandle& Handle) const
+	{
+		const int32 DenseIndex = Sparse.IsValidIndex(Handle.Index) ? Sparse[Handle.Index] : INDEX_NONE;
+		return (DenseIndex != INDEX_NONE && Dense[DenseIndex] == Handle) ? DenseIndex : INDEX_NONE;
+	}
+
+	// Drop handles the registry no longer knows (dead lives) - for holders that never see the release
+	int32 RemoveStale(const UCC_EnemyRegistry& Registry);
+
+	void Reset();
+
+	int32 Num() const { return Dense.Num(); }
+	const FCC_EnemyHandle& operator[](int32 DenseIndex) const { return Dense[DenseIndex]; }
+	const TArray<FCC_EnemyHandle>& GetHandles() const { return Dense; }
+
+	// Range-for over the handles
+	TArray<FCC_EnemyHandle>::RangedForConstIteratorType begin() const { return Dense.begin(); }
+	TArray<FCC_EnemyHandle>::RangedForConstIteratorType end() const { return Dense.end(); }
+
+private:
+	TArray<FCC_EnemyHandle> Dense;
+
+	// Registry slot index -> Dense index
+	TArray<int32> Sparse;
+};
+
+/**
+ * One registry for every actor-backed enemy in the world
+ * Hands out a generational handle per enemy life (spawn or pool reuse until parked / destroyed) and
+ * keeps the per-enemy data other systems poll - actor, alive, collision radius - in dense arrays.
+ * Checking a handle is an index and a generation compare: no weak pointer, no IsValid on the actor.
+ */
+UCLASS()
+class CRISTALCUBE_API UCC_EnemyRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	static UCC_EnemyRegistry* Get(const UObject* WorldContextObject);
+
+	//==========================================================================
+	// LIFETIME
+	//==========================================================================
+
+	// New life for the enemy (spawn / pool reuse), alive
+	FCC_EnemyHandle Register(ACC_EnemyCharacter* Enemy);
+
+	// End of the life (parked, destroyed) - the handle and every copy of it go stale
+	void Unregister(const FCC_EnemyHandle& Handle);
+
+	// Died - still registered until the body is parked
+	void MarkDead(const FCC_EnemyHandle& Handle);
+
+	//==========================================================================
+	// LOOKUP (all O(1))
+	//==========================================================================
+
+	bool IsValidHandle(const FCC_EnemyHandle& Handle) const { return GetDenseIndex(Handle) != INDEX_NONE; }
+
+	int32 GetDenseIndex(const FCC_EnemyHandle& Handle) const
+	{
+		if (!Slots.IsValidIndex(Handle.Index))
+		{
+			return INDEX_NONE;
+		}
+		const FSlot& Slot = Slots[Handle.Index];
+		return Slot.Generation == Handle.Generation ? Slot.DenseIndex : INDEX_NONE;
+	}
+
+	// Registered and not dead
+	bool IsAlive(const FCC_EnemyHandle& Handle) const
+	{
+		const int32 DenseIndex = GetDenseIndex(Handle);
+		return DenseIndex != INDEX_NONE && DenseAlive[DenseIndex] != 0;
+	}
+
+	ACC_EnemyCharacter* Resolve(const FCC_EnemyHandle& Handle) const
+	{
+		const int32 DenseIndex = GetDenseIndex(Handle);
+		return DenseIndex != INDEX_NONE ? DenseActors[DenseIndex] : nullptr;
+	}
+
+	float GetRadius(const FCC_EnemyHandle& Handle) const
+	{
+		const int32 DenseIndex = GetDenseIndex(Handle);
+		return DenseIndex != INDEX_NONE ? DenseRadii[DenseIndex] : 0.0f;
+	}
+
+	//==========================================================================
+	// DENSE DATA (index = GetDenseIndex, order changes on Unregister)
+	//==========================================================================
+
+	int32 Num() const { return DenseHandles.Num(); }
+
+	const TArray<FCC_EnemyHandle>& GetDenseHandles() const { return DenseHandles; }
+	const TArray<ACC_EnemyCharacter*>& GetDenseActors() const { return DenseActors; }
+
+protected:
+	struct FSlot
+	{
+		int32 Generation = 0;
+		int32 DenseIndex = INDEX_NONE;
+	};
+
+	// Sparse side, never shrinks; freed slots are reused LIFO
+	TArray<FSlot> Slots;
+	TArray<int32> FreeSlots;
+
+	// Hot data, one entry per registered enemy
+	TArray<FCC_EnemyHandle> DenseHandles;
+
+	UPROPERTY()
+	TArray<ACC_EnemyCharacter*> DenseActors;
+
+	TArray<uint8> DenseAlive;
+	TArray<float> DenseRadii;
+};
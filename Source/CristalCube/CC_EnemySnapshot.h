@@ -0,0 +1,82 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CC_EnemyRegistry.h"
+#include "CC_EnemySnapshot.generated.h"
+
+// Candidate for k-nearest selection (max-heap on DistSq while searching)
+struct FCC_NearestEntry
+{
+    float DistSq = 0.0f;
+    int32 EntryIndex = INDEX_NONE;
+};
+
+/**
+ * Per-frame structure-of-arrays copy of every registered enemy
+ * Filled by ACC_EnemyManager in spatial hash order (entries of one cell are contiguous),
+ * so all distance math runs over flat float arrays and AActor* is only touched for results.
+ */
+USTRUCT()
+struct CRISTALCUBE_API FCC_EnemySnapshot
+{
+    GENERATED_BODY()
+
+    // Positions
+    TArray<float> X;
+    TArray<float> Y;
+    TArray<float> Z;
+
+    // Collision radius (cached at registration)
+    TArray<float> Radius;
+
+    // 1 = alive, 0 = dying (still registered until destroyed)
+    TArray<uint8> Alive;
+
+    // UCC_EnemyRegistry handle (slot + generation) - identifies the enemy across frames without touching Actors
+    TArray<FCC_EnemyHandle> Handle;
+
+    // Only dereferenced for final results (UPROPERTY so GC clears destroyed actors)
+    UPROPERTY()
+    TArray<AActor*> Actors;
+
+    int32 Num() const { return X.Num(); }
+
+    FVector GetLocation(int32 EntryIndex) const
+    {
+        return FVector(X[EntryIndex], Y[EntryIndex], Z[EntryIndex]);
+    }
+
+    float DistSquared(int32 EntryIndex, const FVector& Location) const
+    {
+        const float DX = X[EntryIndex] - Location.X;
+        const float DY = Y[EntryIndex] - Location.Y;
+        const float DZ = Z[EntryIndex] - Location.Z;
+        return DX * DX + DY * DY + DZ * DZ;
+    }
+
+    // Resize every array (contents are overwritten by the caller)
+    void SetNum(int32 NewNum)
+    {
+        X.SetNumUninitialized(NewNum);
+        Y.SetNumUninitialized(NewNum);
+        Z.SetNumUninitialized(NewNum);
+        Radius.SetNumUninitialized(NewNum);
+        Alive.SetNumUninitialized(NewNum);
+        Handle.SetNumUninitialized(NewNum);
+        Actors.SetNumUninitialized(NewNum);
+    }
+
+    // Drop all entries but keep allocations
+    void Reset()
+    {
+        X.Reset();
+        Y.Reset();
+        Z.Reset();
+        Radius.Reset();
+        Alive.Reset();
+        Handle.Reset();
+        Actors.Reset();
+    }
+};
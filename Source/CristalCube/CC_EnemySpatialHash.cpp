@@ -0,0 +1,82 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CC_EnemySpatialHash.h"
+
+FCC_EnemySpatialHash::FCC_EnemySpatialHash()
+    : CellSize(800.0f)
+    , InvCellSize(1.0f / 800.0f)
+    , OccupiedMin(0, 0)
+    , OccupiedMax(-1, -1)
+{
+}
+
+void FCC_EnemySpatialHash::SetCellSize(float InCellSize)
+{
+    CellSize = FMath::Max(InCellSize, 50.0f);
+    InvCellSize = 1.0f / CellSize;
+}
+
+FIntPoint FCC_EnemySpatialHash::GetCellCoord(const FVector& Location) const
+{
+    return FIntPoint(
+        FMath::FloorToInt(Location.X * InvCellSize),
+        FMath::FloorToInt(Location.Y * InvCellSize)
+    );
+}
+
+void FCC_EnemySpatialHash::Reset()
+{
+    Cells.Reset();
+    EntrySourceIndices.Reset();
+    SourceCells.Reset();
+
+    OccupiedMin = FIntPoint(0, 0);
+    OccupiedMax = FIntPoint(-1, -1);
+}
+
+void FCC_EnemySpatialHash::Build(const TArray<FVector>& Positions)
+{
+    Reset();
+
+    const int32 NumPositions = Positions.Num();
+    if (NumPositions == 0)
+    {
+        return;
+    }
+
+    SourceCells.SetNumUninitialized(NumPositions);
+    EntrySourceIndices.SetNumUninitialized(NumPositions);
+
+    OccupiedMin = FIntPoint(MAX_int32, MAX_int32);
+    OccupiedMax = FIntPoint(MIN_int32, MIN_int32);
+
+    // 1. Count entries per cell
+    for (int32 i = 0; i < NumPositions; ++i)
+    {
+        const FIntPoint Cell = GetCellCoord(Positions[i]);
+        SourceCells[i] = Cell;
+        Cells.FindOrAdd(Cell).Count++;
+
+        OccupiedMin = OccupiedMin.ComponentMin(Cell);
+        OccupiedMax = OccupiedMax.ComponentMax(Cell);
+    }
+
+    // 2. Prefix sum -> start offset of each cell
+    int32 RunningStart = 0;
+    for (TPair<FIntPoint, FCellRange>& Pair : Cells)
+    {
+        Pair.Value.Start = RunningStart;
+        RunningStart += Pair.Value.Count;
+        Pair.Value.Count = 0;
+    }
+
+    // 3. Scatter into cell order
+    for (int32 i = 0; i < NumPositions; ++i)
+    {
+        FCellRange& Range = Cells.FindChecked(SourceCells[i]);
+        const int32 EntryIndex = Range.Start + Range.Count++;
+
+        EntrySourceIndices[EntryIndex] = i;
+    }
+}
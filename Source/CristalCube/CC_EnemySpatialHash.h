@@ -0,0 +1,333 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CC_EnemySnapshot.h"
+#include "CC_Stats.h"
+
+/**
+ * Uniform spatial hash for enemy queries (XY plane)
+ * Rebuilt once per frame by ACC_EnemyManager with a counting sort,
+ * so entries of the same cell are stored contiguously.
+ * The hash only owns the cell ranges and the sort order - positions live in
+ * FCC_EnemySnapshot, which the manager fills in entry order.
+ * Z is not hashed - the cube floor is flat, callers still test full 3D distance.
+ */
+class CRISTALCUBE_API FCC_EnemySpatialHash
+{
+public:
+    FCC_EnemySpatialHash();
+
+    //==========================================================================
+    // BUILD
+    //==========================================================================
+
+    // Cell size in world units (clamped to a sane minimum)
+    void SetCellSize(float InCellSize);
+    float GetCellSize() const { return CellSize; }
+
+    // Rebuild from source positions (index = caller's enemy index)
+    void Build(const TArray<FVector>& Positions);
+
+    // Drop all entries but keep allocations
+    void Reset();
+
+    //==========================================================================
+    // ENTRY ACCESS (entries are sorted by cell)
+    //==========================================================================
+
+    int32 Num() const { return EntrySourceIndices.Num(); }
+
+    // Index into the array passed to Build()
+    int32 GetSourceIndex(int32 EntryIndex) const { return EntrySourceIndices[EntryIndex]; }
+
+    FIntPoint GetCellCoord(const FVector& Location) const;
+
+    //==========================================================================
+    // QUERIES
+    //==========================================================================
+
+    /**
+     * Visit every occupied cell overlapping the XY rectangle
+     * Visitor: void(const FIntPoint& Cell, int32 StartEntry, int32 EndEntry) - half-open, candidates only
+     */
+    template<typename VisitorType>
+    void ForEachCellInRect(const FVector2D& RectMin, const FVector2D& RectMax, VisitorType&& Visitor) const
+    {
+        if (EntrySourceIndices.Num() == 0)
+        {
+            return;
+        }
+
+        const FIntPoint MinCell = GetCellCoord(FVector(RectMin.X, RectMin.Y, 0.0f)).ComponentMax(OccupiedMin);
+        const FIntPoint MaxCell = GetCellCoord(FVector(RectMax.X, RectMax.Y, 0.0f)).ComponentMin(OccupiedMax);
+
+        if (MinCell.X > MaxCell.X || MinCell.Y > MaxCell.Y)
+        {
+            return;
+        }
+
+        const int64 RectCellCount = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+
+        // Rect covers more cells than are occupied - walk the occupied cells instead
+        if (RectCellCount > Cells.Num())
+        {
+            for (const TPair<FIntPoint, FCellRange>& Pair : Cells)
+            {
+                if (Pair.Key.X < MinCell.X || Pair.Key.X > MaxCell.X ||
+                    Pair.Key.Y < MinCell.Y || Pair.Key.Y > MaxCell.Y)
+                {
+                    continue;
+                }
+
+                Visitor(Pair.Key, Pair.Value.Start, Pair.Value.Start + Pair.Value.Count);
+            }
+            return;
+        }
+
+        for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+        {
+            for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+            {
+                const FIntPoint Cell(CellX, CellY);
+                if (const FCellRange* Range = Cells.Find(Cell))
+                {
+                    Visitor(Cell, Range->Start, Range->Start + Range->Count);
+                }
+            }
+        }
+    }
+
+    /**
+     * Visit every cell range overlapping the XY rectangle
+     * Visitor: void(int32 StartEntry, int32 EndEntry) - half-open, candidates only
+     */
+    template<typename VisitorType>
+    void ForEachRangeInRect(const FVector2D& RectMin, const FVector2D& RectMax, VisitorType&& Visitor) const
+    {
+        ForEachCellInRect(RectMin, RectMax, [&Visitor](const FIntPoint& Cell, int32 StartEntry, int32 EndEntry)
+            {
+                Visitor(StartEntry, EndEntry);
+            });
+    }
+
+    /**
+     * Visit every entry whose cell overlaps the XY rectangle
+     * Visitor: void(int32 EntryIndex) - candidates only, caller does the exact test
+     */
+    template<typename VisitorType>
+    void ForEachEntryInRect(const FVector2D& RectMin, const FVector2D& RectMax, VisitorType&& Visitor) const
+    {
+        ForEachRangeInRect(RectMin, RectMax, [&Visitor](int32 StartEntry, int32 EndEntry)
+            {
+                for (int32 EntryIndex = StartEntry; EntryIndex < EndEntry; ++EntryIndex)
+                {
+                    Visitor(EntryIndex);
+                }
+            });
+    }
+
+    /**
+     * Ring-expanding nearest search over the snapshot built alongside this hash
+     * Filter: bool(int32 EntryIndex) - return false to skip an entry (dead, excluded...)
+     * @return Entry index of the nearest accepted entry with DistSq < MaxRadius^2, or INDEX_NONE
+     */
+    template<typename FilterType>
+    int32 FindNearest(const FCC_EnemySnapshot& Snapshot, const FVector& Location, float MaxRadius, FilterType&& Filter, float* OutDistSq = nullptr) const
+    {
+        int32 BestEntry = INDEX_NONE;
+        float BestDistSq = MaxRadius * MaxRadius;
+
+        if (EntrySourceIndices.Num() == 0 || MaxRadius <= 0.0f)
+        {
+            return INDEX_NONE;
+        }
+
+        const FIntPoint Center = GetCellCoord(Location);
+
+        // No ring beyond the search radius or the occupied area can hold a candidate
+        const int32 RadiusRings = FMath::CeilToInt(MaxRadius / CellSize);
+        const int32 ExtentRings = FMath::Max(
+            FMath::Max(FMath::Abs(Center.X - OccupiedMin.X), FMath::Abs(OccupiedMax.X - Center.X)),
+            FMath::Max(FMath::Abs(Center.Y - OccupiedMin.Y), FMath::Abs(OccupiedMax.Y - Center.Y)));
+        const int32 MaxRing = FMath::Min(RadiusRings, ExtentRings);
+
+        auto VisitRingCell = [&](int32 CellX, int32 CellY)
+        {
+            const FCellRange* Range = Cells.Find(FIntPoint(CellX, CellY));
+            if (!Range)
+            {
+                return;
+            }
+
+            INC_DWORD_STAT_BY(STAT_CC_QueryCandidates, Range->Count);
+
+            for (int32 EntryIndex = Range->Start; EntryIndex < Range->Start + Range->Count; ++EntryIndex)
+            {
+                const float DistSq = Snapshot.DistSquared(EntryIndex, Location);
+                if (DistSq < BestDistSq && Filter(EntryIndex))
+                {
+                    BestDistSq = DistSq;
+                    BestEntry = EntryIndex;
+                }
+            }
+        };
+
+        for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+        {
+            if (Ring == 0)
+            {
+                VisitRingCell(Center.X, Center.Y);
+            }
+            else
+            {
+                // Top and bottom rows, then left and right columns without the corners
+                for (int32 CellX = Center.X - Ring; CellX <= Center.X + Ring; ++CellX)
+                {
+                    VisitRingCell(CellX, Center.Y - Ring);
+                    VisitRingCell(CellX, Center.Y + Ring);
+                }
+                for (int32 CellY = Center.Y - Ring + 1; CellY <= Center.Y + Ring - 1; ++CellY)
+                {
+                    VisitRingCell(Center.X - Ring, CellY);
+                    VisitRingCell(Center.X + Ring, CellY);
+                }
+            }
+
+            // Every unvisited cell is at least Ring full cells away
+            const float RingDistance = Ring * CellSize;
+            if (BestEntry != INDEX_NONE && BestDistSq <= RingDistance * RingDistance)
+            {
+                break;
+            }
+        }
+
+        if (OutDistSq)
+        {
+            *OutDistSq = BestDistSq;
+        }
+
+        return BestEntry;
+    }
+
+    /**
+     * Ring-expanding k-nearest search with a bounded max-heap (no allocation beyond OutNearest)
+     * Stops as soon as the K-th best is closer than every unvisited ring.
+     * Filter: bool(int32 EntryIndex)
+     * @param OutNearest - reset, then filled nearest first (at most K)
+     */
+    template<typename FilterType, typename AllocatorType>
+    void FindKNearest(const FCC_EnemySnapshot& Snapshot, const FVector& Location, float MaxRadius, int32 K,
+        FilterType&& Filter, TArray<FCC_NearestEntry, AllocatorType>& OutNearest) const
+    {
+        OutNearest.Reset();
+
+        if (EntrySourceIndices.Num() == 0 || MaxRadius <= 0.0f || K <= 0)
+        {
+            return;
+        }
+
+        // Largest distance on top
+        auto HeapPredicate = [](const FCC_NearestEntry& A, const FCC_NearestEntry& B) { return A.DistSq > B.DistSq; };
+
+        const float MaxRadiusSq = MaxRadius * MaxRadius;
+        const FIntPoint Center = GetCellCoord(Location);
+
+        const int32 RadiusRings = FMath::CeilToInt(MaxRadius / CellSize);
+        const int32 ExtentRings = FMath::Max(
+            FMath::Max(FMath::Abs(Center.X - OccupiedMin.X), FMath::Abs(OccupiedMax.X - Center.X)),
+            FMath::Max(FMath::Abs(Center.Y - OccupiedMin.Y), FMath::Abs(OccupiedMax.Y - Center.Y)));
+        const int32 MaxRing = FMath::Min(RadiusRings, ExtentRings);
+
+        auto VisitRingCell = [&](int32 CellX, int32 CellY)
+        {
+            const FCellRange* Range = Cells.Find(FIntPoint(CellX, CellY));
+            if (!Range)
+            {
+                return;
+            }
+
+            INC_DWORD_STAT_BY(STAT_CC_QueryCandidates, Range->Count);
+
+            for (int32 EntryIndex = Range->Start; EntryIndex < Range->Start + Range->Count; ++EntryIndex)
+            {
+                const float DistSq = Snapshot.DistSquared(EntryIndex, Location);
+                if (DistSq >= MaxRadiusSq)
+                {
+                    continue;
+                }
+
+                const bool bHeapFull = OutNearest.Num() >= K;
+                if (bHeapFull && DistSq >= OutNearest.HeapTop().DistSq)
+                {
+                    continue;
+                }
+
+                if (!Filter(EntryIndex))
+                {
+                    continue;
+                }
+
+                if (bHeapFull)
+                {
+                    OutNearest.HeapPopDiscard(HeapPredicate, EAllowShrinking::No);
+                }
+                OutNearest.HeapPush(FCC_NearestEntry{ DistSq, EntryIndex }, HeapPredicate);
+            }
+        };
+
+        for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+        {
+            if (Ring == 0)
+            {
+                VisitRingCell(Center.X, Center.Y);
+            }
+            else
+            {
+                for (int32 CellX = Center.X - Ring; CellX <= Center.X + Ring; ++CellX)
+                {
+                    VisitRingCell(CellX, Center.Y - Ring);
+                    VisitRingCell(CellX, Center.Y + Ring);
+                }
+                for (int32 CellY = Center.Y - Ring + 1; CellY <= Center.Y + Ring - 1; ++CellY)
+                {
+                    VisitRingCell(Center.X - Ring, CellY);
+                    VisitRingCell(Center.X + Ring, CellY);
+                }
+            }
+
+            const float RingDistance = Ring * CellSize;
+            if (OutNearest.Num() >= K && OutNearest.HeapTop().DistSq <= RingDistance * RingDistance)
+            {
+                break;
+            }
+        }
+
+        // Heap -> nearest first
+        OutNearest.Sort([](const FCC_NearestEntry& A, const FCC_NearestEntry& B) { return A.DistSq < B.DistSq; });
+    }
+
+private:
+    struct FCellRange
+    {
+        int32 Start = 0;
+        int32 Count = 0;
+    };
+
+    float CellSize;
+    float InvCellSize;
+
+    // Cell -> contiguous entry range
+    TMap<FIntPoint, FCellRange> Cells;
+
+    // Bounds of occupied cells (used to clamp rect/ring walks)
+    FIntPoint OccupiedMin;
+    FIntPoint OccupiedMax;
+
+    // Entry (cell order) -> source index
+    TArray<int32> EntrySourceIndices;
+
+    // Build scratch (kept to avoid per-frame allocation)
+    TArray<FIntPoint> SourceCells;
+};
@@ -6,6 +6,10 @@
 #include "Characters/CC_PlayerCharacter.h"
 #include "Gameplay/CC_Cube.h"
 #include "CC_LogHelper.h"
+#include "CC_AIManager.h"
+#include "CC_EnemyPoolSubsystem.h"
+#include "CC_ExperienceGemPoolSubsystem.h"
+#include "CC_EnemyRegistry.h"
 #include "TimerManager.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -54,6 +58,18 @@ void ACC_EnemySpawner::BeginPlay()
     CC_LOG_SPAWNER(Warning, TEXT("EnemySpawner initialized (Interval: %.1fs, Enemies/Spawn: %d, Max: %d)"),
         SpawnInterval, EnemiesPerSpawn, MaxEnemies);
 
+    if (UCC_EnemyPoolSubsystem* Pool = UCC_EnemyPoolSubsystem::Get(this))
+    {
+        Pool->Prewarm(EnemyClass, PoolPrewarmCount, GetActorLocation());
+    }
+
+    // One gem per kill - same count for the gems the prewarmed enemies will drop
+    const ACC_EnemyCharacter* EnemyDefaults = EnemyClass ? EnemyClass->GetDefaultObject<ACC_EnemyCharacter>() : nullptr;
+    if (UCC_ExperienceGemPoolSubsystem* GemPool = EnemyDefaults ? UCC_ExperienceGemPoolSubsystem::Get(this) : nullptr)
+    {
+        GemPool->Prewarm(EnemyDefaults->GetExpGemClass(), PoolPrewarmCount, GetActorLocation());
+    }
+
     if (bAutoStart && !OwnerCube)
     {
         StartSpawning();
@@ -158,15 +174,19 @@ void ACC_EnemySpawner::SpawnEnemies()
 
     int32 SuccessfulSpawns = 0;
 
+    UCC_AIManager* AIManager = bSpawnAsProxies ? UCC_AIManager::Get(this) : nullptr;
+
     for (int32 i = 0; i < EnemiesToSpawn; ++i)
     {
         FVector SpawnLocation = GetRandomSpawnLocation();
 
-        ACC_EnemyCharacter* NewEnemy = SpawnSingleEnemy(SpawnLocation);
+        // Proxy or actor depending on the distance to the player; the AI manager adopts actors back to us
+        const bool bSpawned = AIManager
+            ? AIManager->SpawnEnemy(EnemyClass, SpawnLocation, this)
+            : SpawnSingleEnemy(SpawnLocation) != nullptr;
 
-        if (NewEnemy)
+        if (bSpawned)
         {
-            SpawnedEnemies.Add(NewEnemy);
             SuccessfulSpawns++;
         }
     }
@@ -187,24 +207,13 @@ ACC_EnemyCharacter* ACC_EnemySpawner::SpawnSingleEnemy(const FVector& Location)
 
     FRotator SpawnRotation = FRotator::ZeroRotator;
 
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-
-    ACC_EnemyCharacter* NewEnemy = GetWorld()->SpawnActor<ACC_EnemyCharacter>(
-        EnemyClass,
-        Location,
-        SpawnRotation,
-        SpawnParams
-    );
+    // Pooled enemy when one is free, a new actor otherwise
+    UCC_EnemyPoolSubsystem* Pool = UCC_EnemyPoolSubsystem::Get(this);
+    ACC_EnemyCharacter* NewEnemy = Pool ? Pool->AcquireEnemy(EnemyClass, Location, SpawnRotation) : nullptr;
 
     if (NewEnemy)
     {
-        if (OwnerCube)
-        {
-            OwnerCube->RegisterActor(NewEnemy);
-            CC_LOG_SPAWNER(VeryVerbose, TEXT("Registered enemy with Cube (%d, %d)"),
-                OwnerCube->CubeCoordinate.X, OwnerCube->CubeCoordinate.Y);
-        }
+        AdoptEnemy(NewEnemy);
 
         CC_LOG_SPAWNER(VeryVerbose, TEXT("Spawned enemy at (%.0f, %.0f, %.0f)"),
             Location.X, Location.Y, Location.Z);
@@ -217,6 +226,39 @@ ACC_EnemyCharacter* ACC_EnemySpawner::SpawnSingleEnemy(const FVector& Location)
     return NewEnemy;
 }
 
+void ACC_EnemySpawner::AdoptEnemy(ACC_EnemyCharacter* Enemy)
+{
+    if (!Enemy)
+    {
+        return;
+    }
+
+    Enemy->SetSpawnSource(this);
+    SpawnedEnemies.Add(Enemy->GetEnemyHandle());
+
+    if (OwnerCube)
+    {
+        OwnerCube->RegisterActor(Enemy);
+        CC_LOG_SPAWNER(VeryVerbose, TEXT("Registered enemy with Cube (%d, %d)"),
+            OwnerCube->CubeCoordinate.X, OwnerCube->CubeCoordinate.Y);
+    }
+}
+
+void ACC_EnemySpawner::ReleaseEnemy(ACC_EnemyCharacter* Enemy)
+{
+    if (!Enemy)
+    {
+        return;
+    }
+
+    SpawnedEnemies.Remove(Enemy->GetEnemyHandle());
+
+    if (OwnerCube)
+    {
+        OwnerCube->UnregisterActor(Enemy);
+    }
+}
+
 FVector ACC_EnemySpawner::GetRandomSpawnLocation() const
 {
     FVector SpawnCenter;
@@ -271,10 +313,16 @@ void ACC_EnemySpawner::CleanupDeadEnemies()
 {
     int32 RemovedCount = 0;
 
-    // Remove null and dead enemies from tracking array
+    const UCC_EnemyRegistry* Registry = UCC_EnemyRegistry::Get(this);
+    if (!Registry)
+    {
+        return;
+    }
+
+    // Remove ended and dead enemies from tracking (registry flags, no actor access)
     for (int32 i = SpawnedEnemies.Num() - 1; i >= 0; --i)
     {
-        if (!SpawnedEnemies[i] || !SpawnedEnemies[i]->IsAlive())
+        if (!Registry->IsAlive(SpawnedEnemies[i]))
         {
             SpawnedEnemies.RemoveAt(i);
             RemovedCount++;
@@ -328,14 +376,23 @@ int32 ACC_EnemySpawner::GetAliveEnemyCount() const
 {
     int32 Count = 0;
 
-    for (ACC_EnemyCharacter* Enemy : SpawnedEnemies)
+    if (const UCC_EnemyRegistry* Registry = UCC_EnemyRegistry::Get(this))
     {
-        if (Enemy && Enemy->IsAlive())
+        for (const FCC_EnemyHandle& Handle : SpawnedEnemies)
         {
-            Count++;
+            if (Registry->IsAlive(Handle))
+            {
+                Count++;
+            }
         }
     }
 
+    // Enemies currently living as proxies still count toward MaxEnemies
+    if (const UCC_AIManager* AIManager = UCC_AIManager::Get(this))
+    {
+        Count += AIManager->GetProxyStore().CountFromSource(this);
+    }
+
     return Count;
 }
 
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "GamePlay/CC_Freezable.h"
+#include "CC_EnemyRegistry.h"
 #include "CC_EnemySpawner.generated.h"
 
 class ACC_EnemyCharacter;
@@ -56,6 +57,14 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawner|Settings")
     int32 MaxEnemies = 50;
 
+    /** Spawn out-of-range enemies as UCC_AIManager proxies (no actor until the player comes close) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawner|Settings")
+    bool bSpawnAsProxies = true;
+
+    /** Enemies put into UCC_EnemyPoolSubsystem on BeginPlay, so the first waves don't construct actors */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawner|Settings", meta = (ClampMin = "0"))
+    int32 PoolPrewarmCount = 20;
+
     /** Start spawning automatically on BeginPlay */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawner|Settings")
     bool bAutoStart = true;
@@ -79,9 +88,8 @@ protected:
     /** Timer handle for spawning */
     FTimerHandle SpawnTimerHandle;
 
-    /** Currently spawned enemies */
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Spawner|State")
-    TArray<ACC_EnemyCharacter*> SpawnedEnemies;
+    /** Currently spawned enemies (UCC_EnemyRegistry handles - dead or reused ones go stale) */
+    FCC_EnemyHandleSet SpawnedEnemies;
 
     /** Whether spawner is active */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Spawner|State")
@@ -126,6 +134,14 @@ protected:
     UFUNCTION(BlueprintCallable, Category = "Spawner")
     ACC_EnemyCharacter* SpawnSingleEnemy(const FVector& Location);
 
+public:
+    /** Track an enemy actor as ours (spawned here or hydrated from one of our proxies) */
+    void AdoptEnemy(ACC_EnemyCharacter* Enemy);
+
+    /** Stop tracking an enemy actor (dehydrated into a proxy) */
+    void ReleaseEnemy(ACC_EnemyCharacter* Enemy);
+
+protected:
     /** Get random spawn location around player */
     UFUNCTION(BlueprintCallable, Category = "Spawner")
     FVector GetRandomSpawnLocation() const;
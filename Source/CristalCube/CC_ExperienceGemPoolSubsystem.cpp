@@ -0,0 +1,260 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CC_ExperienceGemPoolSubsystem.h"
+#include "Gameplay/CC_ExperienceGem.h"
+#include "Engine/World.h"
+#include "CC_Stats.h"
+
+void UCC_ExperienceGemPoolSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &UCC_ExperienceGemPoolSubsystem::OnWorldPreActorTick);
+}
+
+void UCC_ExperienceGemPoolSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+
+	for (ACC_ExperienceGem* Gem : ActiveGems)
+	{
+		if (Gem)
+		{
+			Gem->GetPoolActiveIndex() = INDEX_NONE;
+		}
+	}
+
+	// Actors go with the world
+	ActiveGems.Empty();
+	PendingRelease.Empty();
+	Pools.Empty();
+	TotalPooled = 0;
+	SET_DWORD_STAT(STAT_CC_GemPoolSize, 0);
+	SET_DWORD_STAT(STAT_CC_GemsActive, 0);
+
+	UE_LOG(LogTemp, Log, TEXT("Gem pool deinitialized (Hits: %d, Misses: %d)"), HitCount, MissCount);
+
+	Super::Deinitialize();
+}
+
+UCC_ExperienceGemPoolSubsystem* UCC_ExperienceGemPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull))
+	{
+		return World->GetSubsystem<UCC_ExperienceGemPoolSubsystem>();
+	}
+	return nullptr;
+}
+
+ACC_ExperienceGem* UCC_ExperienceGemPoolSubsystem::AcquireGem(TSubclassOf<ACC_ExperienceGem> GemClass, const FVector& Location, float ExpAmount)
+{
+	if (!GemClass)
+	{
+		return nullptr;
+	}
+
+	ACC_ExperienceGem* Gem = nullptr;
+
+	if (FCC_ExperienceGemPoolList* Pool = Pools.Find(GemClass))
+	{
+		while (!Gem && Pool->Gems.Num() > 0)
+		{
+			ACC_ExperienceGem* Candidate = Pool->Gems.Pop(EAllowShrinking::No);
+			--TotalPooled;
+
+			if (IsValid(Candidate))
+			{
+				Gem = Candidate;
+			}
+		}
+	}
+
+	if (Gem)
+	{
+		++HitCount;
+		INC_DWORD_STAT(STAT_CC_GemPoolHits);
+		SET_DWORD_STAT(STAT_CC_GemPoolSize, TotalPooled);
+	}
+	else
+	{
+		++MissCount;
+		INC_DWORD_STAT(STAT_CC_GemPoolMisses);
+
+		Gem = SpawnParkedGem(GemClass, Location);
+		if (!Gem)
+		{
+			return nullptr;
+		}
+	}
+
+	// Tracked before collision comes on - activating within the player's reach collects (and releases) it right away
+	AddActive(Gem);
+	Gem->ActivateGem(Location, ExpAmount);
+
+	return IsValid(Gem) && !Gem->IsPooled() ? Gem : nullptr;
+}
+
+void UCC_ExperienceGemPoolSubsystem::ReleaseGem(ACC_ExperienceGem* Gem)
+{
+	// Already parked (collected and merged in the same frame)
+	if (!IsValid(Gem) || Gem->IsPooled())
+	{
+		return;
+	}
+
+	RemoveActive(Gem);
+	Gem->DeactivateGem();
+
+	FCC_ExperienceGemPoolList& Pool = Pools.FindOrAdd(Gem->GetClass());
+	if (Pool.Gems.Num() >= MaxPooledPerClass)
+	{
+		Gem->Destroy();
+		return;
+	}
+
+	Pool.Gems.Add(Gem);
+	++TotalPooled;
+	SET_DWORD_STAT(STAT_CC_GemPoolSize, TotalPooled);
+}
+
+void UCC_ExperienceGemPoolSubsystem::Prewarm(TSubclassOf<ACC_ExperienceGem> GemClass, int32 Count, const FVector& Location)
+{
+	if (!GemClass || Count <= 0)
+	{
+		return;
+	}
+
+	const int32 Missing = FMath::Min(Count, MaxPooledPerClass) - GetPooledCount(GemClass);
+	if (Missing <= 0)
+	{
+		return;
+	}
+
+	FCC_ExperienceGemPoolList& Pool = Pools.FindOrAdd(GemClass);
+	for (int32 i = 0; i < Missing; ++i)
+	{
+		if (ACC_ExperienceGem* Gem = SpawnParkedGem(GemClass, Location))
+		{
+			Pool.Gems.Add(Gem);
+			++TotalPooled;
+		}
+	}
+
+	SET_DWORD_STAT(STAT_CC_GemPoolSize, TotalPooled);
+	UE_LOG(LogTemp, Log, TEXT("Gem pool prewarmed %s: %d pooled"), *GemClass->GetName(), GetPooledCount(GemClass));
+}
+
+void UCC_ExperienceGemPoolSubsystem::TrackGem(ACC_ExperienceGem* Gem)
+{
+	if (IsValid(Gem) && !Gem->IsPooled())
+	{
+		AddActive(Gem);
+	}
+}
+
+void UCC_ExperienceGemPoolSubsystem::UntrackGem(ACC_ExperienceGem* Gem)
+{
+	if (Gem)
+	{
+		RemoveActive(Gem);
+	}
+}
+
+int32 UCC_ExperienceGemPoolSubsystem::GetPooledCount(TSubclassOf<ACC_ExperienceGem> GemClass) const
+{
+	const FCC_ExperienceGemPoolList* Pool = Pools.Find(GemClass);
+	return Pool ? Pool->Gems.Num() : 0;
+}
+
+void UCC_ExperienceGemPoolSubsystem::OnWorldPreActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != GetWorld() || TickType == LEVELTICK_TimeOnly || TickType == LEVELTICK_PauseTick)
+	{
+		return;
+	}
+
+	UpdateAccumulator += DeltaSeconds;
+	if (UpdateAccumulator < UpdateInterval)
+	{
+		return;
+	}
+
+	const float Elapsed = UpdateAccumulator;
+	UpdateAccumulator = 0.0f;
+
+	UpdateGems(Elapsed);
+}
+
+void UCC_ExperienceGemPoolSubsystem::UpdateGems(float Elapsed)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCC_ExperienceGemPoolSubsystem::UpdateGems);
+	SCOPE_CYCLE_COUNTER(STAT_CC_GemUpdate);
+
+	// Index loop - a level-up triggered by an auto-collect may drop new gems mid-pass
+	for (int32 Index = 0; Index < ActiveGems.Num(); ++Index)
+	{
+		ACC_ExperienceGem* Gem = ActiveGems[Index];
+		if (IsValid(Gem))
+		{
+			Gem->UpdateFromPool(Elapsed, ActiveGems, PendingRelease);
+		}
+	}
+
+	for (ACC_ExperienceGem* Gem : PendingRelease)
+	{
+		ReleaseGem(Gem);
+	}
+	PendingRelease.Reset();
+
+	SET_DWORD_STAT(STAT_CC_GemsActive, ActiveGems.Num());
+}
+
+ACC_ExperienceGem* UCC_ExperienceGemPoolSubsystem::SpawnParkedGem(TSubclassOf<ACC_ExperienceGem> GemClass, const FVector& Location) const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	ACC_ExperienceGem* Gem = World->SpawnActorDeferred<ACC_ExperienceGem>(GemClass, FTransform(Location), nullptr, nullptr,
+		ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (!Gem)
+	{
+		return nullptr;
+	}
+
+	// Collision off before the components register, so the spawn can't collect or merge
+	Gem->DeactivateGem();
+	Gem->FinishSpawning(FTransform(Location));
+	return Gem;
+}
+
+void UCC_ExperienceGemPoolSubsystem::AddActive(ACC_ExperienceGem* Gem)
+{
+	int32& Index = Gem->GetPoolActiveIndex();
+	if (Index != INDEX_NONE)
+	{
+		return;
+	}
+
+	Index = ActiveGems.Add(Gem);
+}
+
+void UCC_ExperienceGemPoolSubsystem::RemoveActive(ACC_ExperienceGem* Gem)
+{
+	int32& Index = Gem->GetPoolActiveIndex();
+	if (!ActiveGems.IsValidIndex(Index) || ActiveGems[Index] != Gem)
+	{
+		Index = INDEX_NONE;
+		return;
+	}
+
+	ActiveGems.RemoveAtSwap(Index, EAllowShrinking::No);
+	if (ActiveGems.IsValidIndex(Index) && ActiveGems[Index])
+	{
+		ActiveGems[Index]->GetPoolActiveIndex() = Index;
+	}
+	Index = INDEX_NONE;
+}
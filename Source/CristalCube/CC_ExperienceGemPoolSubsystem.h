@@ -0,0 +1,113 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CC_ExperienceGemPoolSubsystem.generated.h"
+
+class ACC_ExperienceGem;
+
+// Inactive gems of one class, ready for reuse
+USTRUCT()
+struct FCC_ExperienceGemPoolList
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<ACC_ExperienceGem*> Gems;
+};
+
+/**
+ * Per-class pool of ACC_ExperienceGem actors, plus their update
+ * Enemies drop gems through AcquireGem; collecting, merging and expiry release them here instead
+ * of destroying. The gems' own timers (auto-collect, magnet check, merge, lifetime) are replaced by
+ * one pass over ActiveGems every UpdateInterval, and the gems that pass releases are reset as one
+ * batch after it.
+ */
+UCLASS()
+class CRISTALCUBE_API UCC_ExperienceGemPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintPure, Category = "Gem Pool", meta = (WorldContext = "WorldContextObject"))
+	static UCC_ExperienceGemPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	//==========================================================================
+	// POOL
+	//==========================================================================
+
+	// Pooled gem (hit) or a new one (miss), active at Location worth ExpAmount
+	// Null when the player collected it the moment it appeared (it is back in the pool already)
+	UFUNCTION(BlueprintCallable, Category = "Gem Pool")
+	ACC_ExperienceGem* AcquireGem(TSubclassOf<ACC_ExperienceGem> GemClass, const FVector& Location, float ExpAmount);
+
+	// Switch off and park for reuse (destroyed when the class is at MaxPooledPerClass)
+	UFUNCTION(BlueprintCallable, Category = "Gem Pool")
+	void ReleaseGem(ACC_ExperienceGem* Gem);
+
+	// Spawn parked gems until Count of the class wait in the pool
+	UFUNCTION(BlueprintCallable, Category = "Gem Pool")
+	void Prewarm(TSubclassOf<ACC_ExperienceGem> GemClass, int32 Count, const FVector& Location);
+
+	// Gems spawned outside AcquireGem (placed, Blueprint spawned) - called from their BeginPlay/EndPlay
+	void TrackGem(ACC_ExperienceGem* Gem);
+	void UntrackGem(ACC_ExperienceGem* Gem);
+
+	//==========================================================================
+	// STATS
+	//==========================================================================
+
+	UFUNCTION(BlueprintPure, Category = "Gem Pool")
+	int32 GetActiveCount() const { return ActiveGems.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "Gem Pool")
+	int32 GetPooledCount(TSubclassOf<ACC_ExperienceGem> GemClass) const;
+
+	UFUNCTION(BlueprintPure, Category = "Gem Pool")
+	int32 GetHitCount() const { return HitCount; }
+
+	UFUNCTION(BlueprintPure, Category = "Gem Pool")
+	int32 GetMissCount() const { return MissCount; }
+
+protected:
+	void OnWorldPreActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	// One batched pass, then the releases it produced
+	void UpdateGems(float Elapsed);
+
+	// Spawned already parked - no overlap events or BeginPlay tracking on the way in
+	ACC_ExperienceGem* SpawnParkedGem(TSubclassOf<ACC_ExperienceGem> GemClass, const FVector& Location) const;
+
+	void AddActive(ACC_ExperienceGem* Gem);
+	void RemoveActive(ACC_ExperienceGem* Gem);
+
+	UPROPERTY()
+	TMap<UClass*, FCC_ExperienceGemPoolList> Pools;
+
+	// Gems on the ground, swap-and-pop through ACC_ExperienceGem::GetPoolActiveIndex
+	UPROPERTY()
+	TArray<ACC_ExperienceGem*> ActiveGems;
+
+	// Filled by a pass, emptied right after it
+	UPROPERTY()
+	TArray<ACC_ExperienceGem*> PendingRelease;
+
+	// Seconds between passes (the old per-gem distance check rate)
+	UPROPERTY(EditAnywhere, Category = "Gem Pool", meta = (ClampMin = "0.0"))
+	float UpdateInterval = 0.1f;
+
+	// Parked gems beyond this are destroyed on release
+	UPROPERTY(EditAnywhere, Category = "Gem Pool", meta = (ClampMin = "0"))
+	int32 MaxPooledPerClass = 512;
+
+	FDelegateHandle PreActorTickHandle;
+	float UpdateAccumulator = 0.0f;
+	int32 TotalPooled = 0;
+	int32 HitCount = 0;
+	int32 MissCount = 0;
+};
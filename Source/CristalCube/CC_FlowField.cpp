@@ -0,0 +1,338 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CC_FlowField.h"
+#include "CC_Stats.h"
+
+namespace
+{
+    constexpr uint32 UnreachableCost = MAX_uint32;
+
+    // 8-neighbourhood, orthogonal steps cost 10 and diagonal steps 14 (x cell cost)
+    constexpr int32 NeighbourDX[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+    constexpr int32 NeighbourDY[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+    constexpr uint32 NeighbourStep[8] = { 10, 10, 10, 10, 14, 14, 14, 14 };
+
+    struct FOpenListPredicate
+    {
+        bool operator()(const TPair<uint32, int32>& A, const TPair<uint32, int32>& B) const
+        {
+            return A.Key < B.Key;
+        }
+    };
+}
+
+FCC_FlowField::FCC_FlowField()
+    : Center(FVector2D::ZeroVector)
+    , Origin(FVector2D::ZeroVector)
+    , Size(FVector2D::ZeroVector)
+    , CellSize(200.0f)
+    , InvCellSize(1.0f / 200.0f)
+    , SizeX(0)
+    , SizeY(0)
+    , bWrap(false)
+    , GoalCell(INDEX_NONE, INDEX_NONE)
+    , bDirty(true)
+    , BlockedCount(0)
+{
+}
+
+void FCC_FlowField::Initialize(const FVector2D& InCenter, const FVector2D& InSize, float InCellSize, bool bInWrap)
+{
+    Center = InCenter;
+    Size = InSize;
+    Origin = InCenter - InSize * 0.5;
+    CellSize = FMath::Max(InCellSize, 50.0f);
+    InvCellSize = 1.0f / CellSize;
+    bWrap = bInWrap;
+
+    // Whole cells only, so a wrapping grid tiles the period exactly
+    SizeX = FMath::Max(1, FMath::RoundToInt(InSize.X * InvCellSize));
+    SizeY = FMath::Max(1, FMath::RoundToInt(InSize.Y * InvCellSize));
+
+    const int32 CellCount = SizeX * SizeY;
+    Costs.Init(1, CellCount);
+    Integration.Init(UnreachableCost, CellCount);
+    Directions.Init(FVector2f::ZeroVector, CellCount);
+    LineOfSight.Init(1, CellCount);
+
+    BlockedCount = 0;
+    GoalCell = FIntPoint(INDEX_NONE, INDEX_NONE);
+    bDirty = true;
+}
+
+void FCC_FlowField::Reset()
+{
+    SizeX = 0;
+    SizeY = 0;
+    Costs.Reset();
+    Integration.Reset();
+    Directions.Reset();
+    LineOfSight.Reset();
+    OpenList.Reset();
+    BlockedCount = 0;
+    GoalCell = FIntPoint(INDEX_NONE, INDEX_NONE);
+    bDirty = true;
+}
+
+bool FCC_FlowField::Matches(const FVector2D& InCenter, const FVector2D& InSize, float InCellSize, bool bInWrap) const
+{
+    return IsValid()
+        && bWrap == bInWrap
+        && Center.Equals(InCenter, 1.0)
+        && Size.Equals(InSize, 1.0)
+        && FMath::IsNearlyEqual(CellSize, FMath::Max(InCellSize, 50.0f));
+}
+
+void FCC_FlowField::SetCellCost(const FIntPoint& Cell, uint8 Cost)
+{
+    if (!IsValid() || Cell.X < 0 || Cell.X >= SizeX || Cell.Y < 0 || Cell.Y >= SizeY)
+    {
+        return;
+    }
+
+    Cost = FMath::Max<uint8>(Cost, 1);
+
+    uint8& CellCost = Costs[ToIndex(Cell.X, Cell.Y)];
+    if (CellCost == Cost)
+    {
+        return;
+    }
+
+    BlockedCount += (Cost == BlockedCost) - (CellCost == BlockedCost);
+    CellCost = Cost;
+    bDirty = true;
+}
+
+FIntPoint FCC_FlowField::GetCell(const FVector& Location) const
+{
+    int32 X = FMath::FloorToInt((Location.X - Origin.X) * InvCellSize);
+    int32 Y = FMath::FloorToInt((Location.Y - Origin.Y) * InvCellSize);
+
+    if (bWrap)
+    {
+        X = ((X % SizeX) + SizeX) % SizeX;
+        Y = ((Y % SizeY) + SizeY) % SizeY;
+    }
+    else if (X < 0 || X >= SizeX || Y < 0 || Y >= SizeY)
+    {
+        return FIntPoint(INDEX_NONE, INDEX_NONE);
+    }
+
+    return FIntPoint(X, Y);
+}
+
+int32 FCC_FlowField::GetNeighbourIndex(int32 X, int32 Y, int32 DX, int32 DY) const
+{
+    X += DX;
+    Y += DY;
+
+    if (bWrap)
+    {
+        X = (X + SizeX) % SizeX;
+        Y = (Y + SizeY) % SizeY;
+    }
+    else if (X < 0 || X >= SizeX || Y < 0 || Y >= SizeY)
+    {
+        return INDEX_NONE;
+    }
+
+    return ToIndex(X, Y);
+}
+
+bool FCC_FlowField::Update(const FVector& GoalLocation)
+{
+    if (!IsValid())
+    {
+        return false;
+    }
+
+    const FIntPoint NewGoalCell = GetCell(GoalLocation);
+    if (NewGoalCell.X == INDEX_NONE || (NewGoalCell == GoalCell && !bDirty))
+    {
+        return false;
+    }
+
+    GoalCell = NewGoalCell;
+    Rebuild();
+    return true;
+}
+
+bool FCC_FlowField::SampleDirection(const FVector& Location, FVector2D& OutDirection) const
+{
+    if (!IsValid())
+    {
+        return false;
+    }
+
+    const FIntPoint Cell = GetCell(Location);
+    if (Cell.X == INDEX_NONE || Cell == GoalCell)
+    {
+        return false;
+    }
+
+    const int32 Index = ToIndex(Cell.X, Cell.Y);
+    if (LineOfSight[Index])
+    {
+        return false;
+    }
+
+    const FVector2f& Direction = Directions[Index];
+    if (Direction.IsZero())
+    {
+        return false;
+    }
+
+    OutDirection = FVector2D(Direction);
+    return true;
+}
+
+void FCC_FlowField::Rebuild()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(FCC_FlowField::Rebuild);
+    SCOPE_CYCLE_COUNTER(STAT_CC_AIFlowField);
+
+    // Open field - every cell sees the goal and SampleDirection never reads the grid, skip both passes
+    if (BlockedCount == 0)
+    {
+        FMemory::Memset(LineOfSight.GetData(), 1, LineOfSight.Num());
+        bDirty = false;
+        return;
+    }
+
+    BuildIntegrationField();
+    BuildDirectionField();
+
+    bDirty = false;
+}
+
+void FCC_FlowField::BuildIntegrationField()
+{
+    for (uint32& Cost : Integration)
+    {
+        Cost = UnreachableCost;
+    }
+
+    OpenList.Reset();
+
+    const int32 GoalIndex = ToIndex(GoalCell.X, GoalCell.Y);
+    Integration[GoalIndex] = 0;
+    OpenList.HeapPush(TPair<uint32, int32>(0, GoalIndex), FOpenListPredicate());
+
+    while (OpenList.Num() > 0)
+    {
+        TPair<uint32, int32> Current;
+        OpenList.HeapPop(Current, FOpenListPredicate(), EAllowShrinking::No);
+
+        // Stale entry (cell was reached cheaper after it was pushed)
+        if (Current.Key > Integration[Current.Value])
+        {
+            continue;
+        }
+
+        const int32 X = Current.Value % SizeX;
+        const int32 Y = Current.Value / SizeX;
+
+        for (int32 Dir = 0; Dir < 8; ++Dir)
+        {
+            const int32 NeighbourIndex = GetNeighbourIndex(X, Y, NeighbourDX[Dir], NeighbourDY[Dir]);
+            if (NeighbourIndex == INDEX_NONE || Costs[NeighbourIndex] == BlockedCost)
+            {
+                continue;
+            }
+
+            // No corner cutting past a wall
+            if (Dir >= 4)
+            {
+                const int32 SideX = GetNeighbourIndex(X, Y, NeighbourDX[Dir], 0);
+                const int32 SideY = GetNeighbourIndex(X, Y, 0, NeighbourDY[Dir]);
+                if (Costs[SideX] == BlockedCost || Costs[SideY] == BlockedCost)
+                {
+                    continue;
+                }
+            }
+
+            const uint32 NewCost = Current.Key + NeighbourStep[Dir] * Costs[NeighbourIndex];
+            if (NewCost < Integration[NeighbourIndex])
+            {
+                Integration[NeighbourIndex] = NewCost;
+                OpenList.HeapPush(TPair<uint32, int32>(NewCost, NeighbourIndex), FOpenListPredicate());
+            }
+        }
+    }
+}
+
+void FCC_FlowField::BuildDirectionField()
+{
+    for (int32 Y = 0; Y < SizeY; ++Y)
+    {
+        for (int32 X = 0; X < SizeX; ++X)
+        {
+            const int32 Index = ToIndex(X, Y);
+
+            // Open field - straight pursuit is exact, skip the grid directions
+            LineOfSight[Index] = (BlockedCount == 0 || HasLineOfSight(X, Y)) ? 1 : 0;
+
+            FVector2f& Direction = Directions[Index];
+            Direction = FVector2f::ZeroVector;
+
+            if (Integration[Index] == UnreachableCost || LineOfSight[Index])
+            {
+                continue;
+            }
+
+            // Cheapest neighbour (same corner rule as the integration pass)
+            uint32 BestCost = Integration[Index];
+            for (int32 Dir = 0; Dir < 8; ++Dir)
+            {
+                const int32 NeighbourIndex = GetNeighbourIndex(X, Y, NeighbourDX[Dir], NeighbourDY[Dir]);
+                if (NeighbourIndex == INDEX_NONE || Integration[NeighbourIndex] >= BestCost)
+                {
+                    continue;
+                }
+
+                if (Dir >= 4)
+                {
+                    const int32 SideX = GetNeighbourIndex(X, Y, NeighbourDX[Dir], 0);
+                    const int32 SideY = GetNeighbourIndex(X, Y, 0, NeighbourDY[Dir]);
+                    if (Costs[SideX] == BlockedCost || Costs[SideY] == BlockedCost)
+                    {
+                        continue;
+                    }
+                }
+
+                BestCost = Integration[NeighbourIndex];
+                Direction = FVector2f(NeighbourDX[Dir], NeighbourDY[Dir]).GetSafeNormal();
+            }
+        }
+    }
+}
+
+bool FCC_FlowField::HasLineOfSight(int32 X, int32 Y) const
+{
+    // Shortest way round on a torus
+    int32 DX = GoalCell.X - X;
+    int32 DY = GoalCell.Y - Y;
+    if (bWrap)
+    {
+        if (FMath::Abs(DX) * 2 > SizeX) { DX -= FMath::Sign(DX) * SizeX; }
+        if (FMath::Abs(DY) * 2 > SizeY) { DY -= FMath::Sign(DY) * SizeY; }
+    }
+
+    // Sample the segment at half-cell steps
+    const int32 Steps = FMath::Max(FMath::Abs(DX), FMath::Abs(DY)) * 2;
+    for (int32 Step = 1; Step < Steps; ++Step)
+    {
+        const float Alpha = float(Step) / Steps;
+        const int32 CellX = FMath::RoundToInt(X + DX * Alpha);
+        const int32 CellY = FMath::RoundToInt(Y + DY * Alpha);
+
+        const int32 Index = GetNeighbourIndex(CellX, CellY, 0, 0);
+        if (Index == INDEX_NONE || Costs[Index] == BlockedCost)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
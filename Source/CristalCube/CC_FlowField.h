@@ -0,0 +1,103 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Shared pursuit field over the active tile area (XY plane)
+ * One Dijkstra pass from the goal cell fills the integration field, every cell then stores
+ * the direction to its cheapest neighbour - enemies sample it in O(1), so the cost depends on
+ * the area, not on the number of enemies. Rebuilt only when the goal changes cell or a cost changes,
+ * and without walls the rebuild is skipped (straight pursuit everywhere).
+ * With bWrap the grid is a torus (same domain as FCC_WorldWrap), so paths may cross the seams.
+ */
+class CRISTALCUBE_API FCC_FlowField
+{
+public:
+    // Cost of a cell nothing can walk through
+    static constexpr uint8 BlockedCost = 255;
+
+    FCC_FlowField();
+
+    //==========================================================================
+    // SETUP
+    //==========================================================================
+
+    // Cover Center +- Size / 2 with CellSize cells (all passable, cost 1)
+    void Initialize(const FVector2D& InCenter, const FVector2D& InSize, float InCellSize, bool bInWrap);
+
+    // Drop the grid (IsValid() is false until the next Initialize)
+    void Reset();
+
+    bool IsValid() const { return SizeX > 0 && SizeY > 0; }
+
+    // Same grid as Initialize would build with these arguments
+    bool Matches(const FVector2D& InCenter, const FVector2D& InSize, float InCellSize, bool bInWrap) const;
+
+    // 1 = open ground, higher = avoid, BlockedCost = wall (marks the field for rebuild)
+    void SetCellCost(const FIntPoint& Cell, uint8 Cost);
+
+    //==========================================================================
+    // UPDATE
+    //==========================================================================
+
+    // Rebuild toward GoalLocation if its cell changed or costs changed
+    // @return true if the field was rebuilt
+    bool Update(const FVector& GoalLocation);
+
+    //==========================================================================
+    // SAMPLING (read-only, safe from worker threads between updates)
+    //==========================================================================
+
+    // Cell under Location (wrapped onto the torus, INDEX_NONE outside a non-wrapping grid)
+    FIntPoint GetCell(const FVector& Location) const;
+
+    /**
+     * Direction to follow from Location
+     * @return false when the caller should steer straight at the goal
+     *         (goal cell, clear line of sight, outside the field or unreachable)
+     */
+    bool SampleDirection(const FVector& Location, FVector2D& OutDirection) const;
+
+    FIntPoint GetGoalCell() const { return GoalCell; }
+    int32 GetCellCount() const { return SizeX * SizeY; }
+
+private:
+    int32 ToIndex(int32 X, int32 Y) const { return Y * SizeX + X; }
+
+    // Neighbour of (X, Y) by (DX, DY), wrapped or INDEX_NONE off the grid
+    int32 GetNeighbourIndex(int32 X, int32 Y, int32 DX, int32 DY) const;
+
+    void Rebuild();
+    void BuildIntegrationField();
+    void BuildDirectionField();
+
+    // Straight walk from the cell to the goal crosses no blocked cell
+    bool HasLineOfSight(int32 X, int32 Y) const;
+
+private:
+    FVector2D Center;
+    FVector2D Origin;  // Min corner
+    FVector2D Size;
+    float CellSize;
+    float InvCellSize;
+    int32 SizeX;
+    int32 SizeY;
+    bool bWrap;
+
+    FIntPoint GoalCell;
+    bool bDirty;
+    int32 BlockedCount;
+
+    // Per cell
+    TArray<uint8> Costs;
+    TArray<uint32> Integration;
+    TArray<FVector2f> Directions;
+
+    // 1 = steer straight at the goal (no wall in between)
+    TArray<uint8> LineOfSight;
+
+    // Dijkstra open list (key = integration cost), reused between rebuilds
+    TArray<TPair<uint32, int32>> OpenList;
+};
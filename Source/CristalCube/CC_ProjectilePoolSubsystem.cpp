@@ -0,0 +1,126 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CC_ProjectilePoolSubsystem.h"
+#include "WeaponSystems/CC_Projectile.h"
+#include "Engine/World.h"
+#include "CC_Stats.h"
+
+void UCC_ProjectilePoolSubsystem::Deinitialize()
+{
+	// Actors go with the world
+	Pools.Empty();
+	TotalPooled = 0;
+	SET_DWORD_STAT(STAT_CC_ProjectilePoolSize, 0);
+
+	UE_LOG(LogTemp, Log, TEXT("Projectile pool deinitialized (Hits: %d, Misses: %d)"), HitCount, MissCount);
+
+	Super::Deinitialize();
+}
+
+UCC_ProjectilePoolSubsystem* UCC_ProjectilePoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull))
+	{
+		return World->GetSubsystem<UCC_ProjectilePoolSubsystem>();
+	}
+	return nullptr;
+}
+
+ACC_Projectile* UCC_ProjectilePoolSubsystem::AcquireProjectile(TSubclassOf<ACC_Projectile> ProjectileClass, const FVector& Location, const FRotator& Rotation, AActor* ProjectileOwner)
+{
+	if (!ProjectileClass)
+	{
+		return nullptr;
+	}
+
+	if (FCC_ProjectilePoolList* Pool = Pools.Find(ProjectileClass))
+	{
+		while (Pool->Projectiles.Num() > 0)
+		{
+			ACC_Projectile* Projectile = Pool->Projectiles.Pop(EAllowShrinking::No);
+			--TotalPooled;
+
+			if (!IsValid(Projectile))
+			{
+				continue;
+			}
+
+			Projectile->SetOwner(ProjectileOwner);
+			Projectile->SetInstigator(Cast<APawn>(ProjectileOwner));
+			Projectile->ActivateFromPool(Location, Rotation);
+
+			++HitCount;
+			INC_DWORD_STAT(STAT_CC_ProjectilePoolHits);
+			SET_DWORD_STAT(STAT_CC_ProjectilePoolSize, TotalPooled);
+			return Projectile;
+		}
+	}
+
+	++MissCount;
+	INC_DWORD_STAT(STAT_CC_ProjectilePoolMisses);
+	return SpawnProjectile(ProjectileClass, Location, Rotation, ProjectileOwner);
+}
+
+void UCC_ProjectilePoolSubsystem::ReleaseProjectile(ACC_Projectile* Projectile)
+{
+	// Already parked (several overlaps in one sweep can all ask to stop)
+	if (!IsValid(Projectile) || Projectile->IsPooled())
+	{
+		return;
+	}
+
+	Projectile->DeactivateToPool();
+
+	FCC_ProjectilePoolList& Pool = Pools.FindOrAdd(Projectile->GetClass());
+	if (Pool.Projectiles.Num() >= MaxPooledPerClass)
+	{
+		Projectile->Destroy();
+		return;
+	}
+
+	Pool.Projectiles.Add(Projectile);
+	++TotalPooled;
+	SET_DWORD_STAT(STAT_CC_ProjectilePoolSize, TotalPooled);
+}
+
+void UCC_ProjectilePoolSubsystem::Prewarm(TSubclassOf<ACC_Projectile> ProjectileClass, int32 Count, const FVector& Location)
+{
+	if (!ProjectileClass || Count <= 0)
+	{
+		return;
+	}
+
+	const int32 Missing = FMath::Min(Count, MaxPooledPerClass) - GetPooledCount(ProjectileClass);
+	for (int32 i = 0; i < Missing; ++i)
+	{
+		if (ACC_Projectile* Projectile = SpawnProjectile(ProjectileClass, Location, FRotator::ZeroRotator, nullptr))
+		{
+			ReleaseProjectile(Projectile);
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Projectile pool prewarmed %s: %d pooled"), *ProjectileClass->GetName(), GetPooledCount(ProjectileClass));
+}
+
+int32 UCC_ProjectilePoolSubsystem::GetPooledCount(TSubclassOf<ACC_Projectile> ProjectileClass) const
+{
+	const FCC_ProjectilePoolList* Pool = Pools.Find(ProjectileClass);
+	return Pool ? Pool->Projectiles.Num() : 0;
+}
+
+ACC_Projectile* UCC_ProjectilePoolSubsystem::SpawnProjectile(TSubclassOf<ACC_Projectile> ProjectileClass, const FVector& Location, const FRotator& Rotation, AActor* ProjectileOwner) const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = ProjectileOwner;
+	SpawnParams.Instigator = Cast<APawn>(ProjectileOwner);
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	return World->SpawnActor<ACC_Projectile>(ProjectileClass, Location, Rotation, SpawnParams);
+}
@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CC_ProjectilePoolSubsystem.generated.h"
+
+class ACC_Projectile;
+
+// Inactive projectiles of one class, ready for reuse
+USTRUCT()
+struct FCC_ProjectilePoolList
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<ACC_Projectile*> Projectiles;
+};
+
+/**
+ * Per-class pool of ACC_Projectile actors
+ * Weapons acquire instead of SpawnActor, a projectile that hits or expires comes back here instead of
+ * being destroyed (ACC_Projectile::ReturnToPool). Equipped ranged weapons prewarm their class.
+ */
+UCLASS()
+class CRISTALCUBE_API UCC_ProjectilePoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintPure, Category = "Projectile Pool", meta = (WorldContext = "WorldContextObject"))
+	static UCC_ProjectilePoolSubsystem* Get(const UObject* WorldContextObject);
+
+	// Pooled projectile (hit) or a new one (miss), active at the transform - call InitializeProjectile next
+	UFUNCTION(BlueprintCallable, Category = "Projectile Pool")
+	ACC_Projectile* AcquireProjectile(TSubclassOf<ACC_Projectile> ProjectileClass, const FVector& Location, const FRotator& Rotation, AActor* ProjectileOwner);
+
+	// Switch off and park for reuse (destroyed when the class is at MaxPooledPerClass)
+	UFUNCTION(BlueprintCallable, Category = "Projectile Pool")
+	void ReleaseProjectile(ACC_Projectile* Projectile);
+
+	// Spawn until Count projectiles of the class wait in the pool
+	UFUNCTION(BlueprintCallable, Category = "Projectile Pool")
+	void Prewarm(TSubclassOf<ACC_Projectile> ProjectileClass, int32 Count, const FVector& Location);
+
+	UFUNCTION(BlueprintPure, Category = "Projectile Pool")
+	int32 GetPooledCount(TSubclassOf<ACC_Projectile> ProjectileClass) const;
+
+	UFUNCTION(BlueprintPure, Category = "Projectile Pool")
+	int32 GetHitCount() const { return HitCount; }
+
+	UFUNCTION(BlueprintPure, Category = "Projectile Pool")
+	int32 GetMissCount() const { return MissCount; }
+
+protected:
+	ACC_Projectile* SpawnProjectile(TSubclassOf<ACC_Projectile> ProjectileClass, const FVector& Location, const FRotator& Rotation, AActor* ProjectileOwner) const;
+
+	UPROPERTY()
+	TMap<UClass*, FCC_ProjectilePoolList> Pools;
+
+	// Parked projectiles beyond this are destroyed on release
+	UPROPERTY(EditAnywhere, Category = "Projectile Pool", meta = (ClampMin = "0"))
+	int32 MaxPooledPerClass = 512;
+
+	int32 TotalPooled = 0;
+	int32 HitCount = 0;
+	int32 MissCount = 0;
+};
@@ -3,6 +3,16 @@
 
 #include "CC_SearchingComponent.h"
 #include "CC_EnemyManager.h"
+#include "CC_Stats.h"
+
+// Searching component cost per search type ("stat CristalCube")
+DECLARE_CYCLE_STAT(TEXT("Search: Nearest Enemy"), STAT_CC_SearchNearestEnemy, STATGROUP_CristalCube);
+DECLARE_CYCLE_STAT(TEXT("Search: Nearest In Direction"), STAT_CC_SearchNearestInDirection, STATGROUP_CristalCube);
+DECLARE_CYCLE_STAT(TEXT("Search: Random Enemies"), STAT_CC_SearchRandomEnemies, STATGROUP_CristalCube);
+DECLARE_CYCLE_STAT(TEXT("Search: Nearest Enemies"), STAT_CC_SearchNearestEnemies, STATGROUP_CristalCube);
+DECLARE_CYCLE_STAT(TEXT("Search: Sphere"), STAT_CC_SearchSphere, STATGROUP_CristalCube);
+DECLARE_CYCLE_STAT(TEXT("Search: Cone"), STAT_CC_SearchCone, STATGROUP_CristalCube);
+DECLARE_CYCLE_STAT(TEXT("Search: Box"), STAT_CC_SearchBox, STATGROUP_CristalCube);
 
 // Sets default values for this component's properties
 UCC_SearchingComponent::UCC_SearchingComponent()
@@ -41,9 +51,13 @@ void UCC_SearchingComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 
 AActor* UCC_SearchingComponent::FindNearestEnemy(FVector SearchOrigin, float SearchRadius)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCC_SearchingComponent::FindNearestEnemy);
+	SCOPE_CYCLE_COUNTER(STAT_CC_SearchNearestEnemy);
+
 	if (!EnemyManager) return nullptr;
 
-	AActor* NearestEnemy = EnemyManager->GetNearestEnemy(SearchOrigin, SearchRadius);
+	// Keeps returning the last target until it dies, leaves range or this component moves
+	AActor* NearestEnemy = EnemyManager->GetCachedNearestEnemy(this, SearchOrigin, SearchRadius);
 
 	if (bEnableDebugVisualization && NearestEnemy)
 	{
@@ -64,153 +78,138 @@ AActor* UCC_SearchingComponent::FindNearestEnemy(FVector SearchOrigin, float Sea
 
 AActor* UCC_SearchingComponent::FindNearestEnemyInDirection(FVector SearchOrigin, FVector Direction, float MaxAngle, float SearchRadius)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCC_SearchingComponent::FindNearestEnemyInDirection);
+	SCOPE_CYCLE_COUNTER(STAT_CC_SearchNearestInDirection);
+
 	if (!EnemyManager) return nullptr;
 
-	TArray<AActor*> AllEnemies = EnemyManager->GetEnemiesInRadius(SearchOrigin, SearchRadius);
-	Direction.Normalize();
+	// Cone kernel does the angle test, only the distance compare is left here
+	EnemyManager->GetEntriesInShape(FCC_EnemyShapeQuery::MakeCone(SearchOrigin, Direction, SearchRadius, MaxAngle), ScratchEntries);
+	const FCC_EnemySnapshot& Snapshot = EnemyManager->GetEnemySnapshot();
+	const FCC_WorldWrap& WorldWrap = EnemyManager->GetWorldWrap();
 
-	AActor* BestEnemy = nullptr;
-	float BestDistance = FLT_MAX;
+	int32 BestEntry = INDEX_NONE;
+	float BestDistSq = FLT_MAX;
 
-	for (AActor* Enemy : AllEnemies)
+	for (int32 EntryIndex : ScratchEntries)
 	{
-		if (!Enemy) continue;
+		float DistSq = WorldWrap.DistSquared(SearchOrigin, Snapshot.GetLocation(EntryIndex));
 
-		FVector ToEnemy = Enemy->GetActorLocation() - SearchOrigin;
-		float Distance = ToEnemy.Size();
-		ToEnemy.Normalize();
-
-		float DotProduct = FVector::DotProduct(Direction, ToEnemy);
-		float AngleInDegrees = FMath::RadiansToDegrees(FMath::Acos(DotProduct));
-
-		if (AngleInDegrees <= MaxAngle && Distance < BestDistance)
+		if (DistSq < BestDistSq)
 		{
-			BestEnemy = Enemy;
-			BestDistance = Distance;
+			BestEntry = EntryIndex;
+			BestDistSq = DistSq;
 		}
 	}
 
-	return BestEnemy;
+	return BestEntry != INDEX_NONE ? Snapshot.Actors[BestEntry] : nullptr;
 }
 
 TArray<AActor*> UCC_SearchingComponent::FindRandomEnemies(FVector SearchOrigin, float SearchRadius, int32 Count)
 {
 	TArray<AActor*> SelectedEnemies;
-	if (!EnemyManager || Count <= 0) return SelectedEnemies;
-
-	TArray<AActor*> PotentialTargets = EnemyManager->GetEnemiesInRadius(SearchOrigin, SearchRadius);
-	int32 SelectCount = FMath::Min(Count, PotentialTargets.Num());
+	FindRandomEnemies(SearchOrigin, SearchRadius, Count, SelectedEnemies);
+	return SelectedEnemies;
+}
 
-	for (int32 i = 0; i < SelectCount; i++)
-	{
-		if (PotentialTargets.Num() == 0) break;
+int32 UCC_SearchingComponent::FindRandomEnemies(FVector SearchOrigin, float SearchRadius, int32 Count, TArray<AActor*>& OutEnemies)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCC_SearchingComponent::FindRandomEnemies);
+	SCOPE_CYCLE_COUNTER(STAT_CC_SearchRandomEnemies);
 
-		int32 RandomIndex = FMath::RandRange(0, PotentialTargets.Num() - 1);
-		SelectedEnemies.Add(PotentialTargets[RandomIndex]);
-		PotentialTargets.RemoveAt(RandomIndex);
-	}
+	OutEnemies.Reset();
+	if (!EnemyManager || Count <= 0) return 0;
 
-	return SelectedEnemies;
+	// Partial Fisher-Yates in the manager - O(Count) picks instead of RemoveAt per pick
+	return EnemyManager->GetRandomEnemies(SearchOrigin, SearchRadius, Count, OutEnemies);
 }
 
 TArray<AActor*> UCC_SearchingComponent::FindNearestEnemies(FVector SearchOrigin, float SearchRadius, int32 Count)
 {
 	TArray<AActor*> NearestEnemies;
-	if (!EnemyManager || Count <= 0) return NearestEnemies;
-
-	TArray<AActor*> AllEnemies = EnemyManager->GetEnemiesInRadius(SearchOrigin, SearchRadius);
+	FindNearestEnemies(SearchOrigin, SearchRadius, Count, NearestEnemies);
+	return NearestEnemies;
+}
 
-	AllEnemies.Sort([SearchOrigin](const AActor& A, const AActor& B)
-		{
-			float DistA = FVector::DistSquared(SearchOrigin, A.GetActorLocation());
-			float DistB = FVector::DistSquared(SearchOrigin, B.GetActorLocation());
-			return DistA < DistB;
-		});
+int32 UCC_SearchingComponent::FindNearestEnemies(FVector SearchOrigin, float SearchRadius, int32 Count, TArray<AActor*>& OutEnemies)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCC_SearchingComponent::FindNearestEnemies);
+	SCOPE_CYCLE_COUNTER(STAT_CC_SearchNearestEnemies);
 
-	int32 SelectCount = FMath::Min(Count, AllEnemies.Num());
-	for (int32 i = 0; i < SelectCount; i++)
-	{
-		NearestEnemies.Add(AllEnemies[i]);
-	}
+	OutEnemies.Reset();
+	if (!EnemyManager || Count <= 0) return 0;
 
-	return NearestEnemies;
+	// k-nearest on the grid (bounded heap) - no full sort of everything in range
+	return EnemyManager->GetNearestEnemies(SearchOrigin, SearchRadius, Count, OutEnemies);
 }
 
 TArray<AActor*> UCC_SearchingComponent::GetEnemiesInSphere(FVector Center, float Radius)
 {
-	if (!EnemyManager) return TArray<AActor*>();
+	TArray<AActor*> Enemies;
+	GetEnemiesInSphere(Center, Radius, Enemies);
+	return Enemies;
+}
+
+int32 UCC_SearchingComponent::GetEnemiesInSphere(FVector Center, float Radius, TArray<AActor*>& OutEnemies)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCC_SearchingComponent::GetEnemiesInSphere);
+	SCOPE_CYCLE_COUNTER(STAT_CC_SearchSphere);
+
+	OutEnemies.Reset();
+	if (!EnemyManager) return 0;
 
-	TArray<AActor*> Enemies = EnemyManager->GetEnemiesInRadius(Center, Radius);
+	EnemyManager->GetEnemiesInRadius(Center, Radius, OutEnemies);
 
 	if (bEnableDebugVisualization)
 	{
 		DebugDrawSphere(Center, Radius, FColor::Blue, 0.5f);
 	}
 
-	return Enemies;
+	return OutEnemies.Num();
 }
 
 TArray<AActor*> UCC_SearchingComponent::GetEnemiesInCone(FVector Origin, FVector Direction, float Range, float Angle)
 {
 	TArray<AActor*> EnemiesInCone;
-	if (!EnemyManager) return EnemiesInCone;
-
-	Direction.Normalize();
-	TArray<AActor*> AllEnemies = EnemyManager->GetEnemiesInRadius(Origin, Range);
-
-	float HalfAngle = Angle * 0.5f;
-
-	for (AActor* Enemy : AllEnemies)
-	{
-		if (!Enemy) continue;
-
-		FVector ToEnemy = Enemy->GetActorLocation() - Origin;
-		float Distance = ToEnemy.Size();
+	GetEnemiesInCone(Origin, Direction, Range, Angle, EnemiesInCone);
+	return EnemiesInCone;
+}
 
-		if (Distance > Range) continue;
+int32 UCC_SearchingComponent::GetEnemiesInCone(FVector Origin, FVector Direction, float Range, float Angle, TArray<AActor*>& OutEnemies)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCC_SearchingComponent::GetEnemiesInCone);
+	SCOPE_CYCLE_COUNTER(STAT_CC_SearchCone);
 
-		ToEnemy.Normalize();
-		float DotProduct = FVector::DotProduct(Direction, ToEnemy);
-		float AngleInDegrees = FMath::RadiansToDegrees(FMath::Acos(DotProduct));
+	OutEnemies.Reset();
+	if (!EnemyManager) return 0;
 
-		if (AngleInDegrees <= HalfAngle)
-		{
-			EnemiesInCone.Add(Enemy);
-		}
-	}
+	Direction.Normalize();
+	EnemyManager->GetEnemiesInCone(Origin, Direction, Range, Angle * 0.5f, OutEnemies);
 
 	if (bEnableDebugVisualization)
 	{
 		DebugDrawCone(Origin, Direction, Range, Angle, FColor::Red, 0.5f);
 	}
 
-	return EnemiesInCone;
+	return OutEnemies.Num();
 }
 
 TArray<AActor*> UCC_SearchingComponent::GetEnemiesInBox(FVector Center, FVector HalfExtents, FRotator Rotation)
 {
 	TArray<AActor*> EnemiesInBox;
-	if (!EnemyManager) return EnemiesInBox;
-
-	float MaxExtent = FMath::Max3(HalfExtents.X, HalfExtents.Y, HalfExtents.Z);
-	TArray<AActor*> AllEnemies = EnemyManager->GetEnemiesInRadius(Center, MaxExtent * 1.5f);
-
-	FTransform BoxTransform(Rotation, Center);
+	GetEnemiesInBox(Center, HalfExtents, Rotation, EnemiesInBox);
+	return EnemiesInBox;
+}
 
-	for (AActor* Enemy : AllEnemies)
-	{
-		if (!Enemy) continue;
+int32 UCC_SearchingComponent::GetEnemiesInBox(FVector Center, FVector HalfExtents, FRotator Rotation, TArray<AActor*>& OutEnemies)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCC_SearchingComponent::GetEnemiesInBox);
+	SCOPE_CYCLE_COUNTER(STAT_CC_SearchBox);
 
-		FVector LocalPos = BoxTransform.InverseTransformPosition(Enemy->GetActorLocation());
+	OutEnemies.Reset();
+	if (!EnemyManager) return 0;
 
-		// ڽ üũ
-		if (FMath::Abs(LocalPos.X) <= HalfExtents.X &&
-			FMath::Abs(LocalPos.Y) <= HalfExtents.Y &&
-			FMath::Abs(LocalPos.Z) <= HalfExtents.Z)
-		{
-			EnemiesInBox.Add(Enemy);
-		}
-	}
+	EnemyManager->GetEnemiesInBox(Center, HalfExtents, Rotation, OutEnemies);
 
 	if (bEnableDebugVisualization)
 	{
@@ -227,7 +226,7 @@ TArray<AActor*> UCC_SearchingComponent::GetEnemiesInBox(FVector Center, FVector
 		);
 	}
 
-	return EnemiesInBox;
+	return OutEnemies.Num();
 }
 
 TArray<FRotator> UCC_SearchingComponent::CalculateSpreadRotations(FRotator BaseRotation, int32 Count, float SpreadAngle)
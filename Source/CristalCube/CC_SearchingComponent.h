@@ -23,6 +23,9 @@ protected:
 	UPROPERTY()
 	class ACC_EnemyManager* EnemyManager;
 
+	// Reused entry buffer for direction searches (no allocation per call)
+	TArray<int32> ScratchEntries;
+
 public:	
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -47,6 +50,9 @@ public:
 		int32 Count
 	);
 
+	// Caller-owned buffer versions (OutEnemies is reset, capacity kept)
+	int32 FindRandomEnemies(FVector SearchOrigin, float SearchRadius, int32 Count, TArray<AActor*>& OutEnemies);
+
 	UFUNCTION(BlueprintCallable, Category = "Searching|Multiple")
 	TArray<AActor*> FindNearestEnemies(
 		FVector SearchOrigin,
@@ -54,9 +60,13 @@ public:
 		int32 Count
 	);
 
+	int32 FindNearestEnemies(FVector SearchOrigin, float SearchRadius, int32 Count, TArray<AActor*>& OutEnemies);
+
 	UFUNCTION(BlueprintCallable, Category = "Searching|Area")
 	TArray<AActor*> GetEnemiesInSphere(FVector Center, float Radius);
 
+	int32 GetEnemiesInSphere(FVector Center, float Radius, TArray<AActor*>& OutEnemies);
+
 	UFUNCTION(BlueprintCallable, Category = "Searching|Area")
 	TArray<AActor*> GetEnemiesInCone(
 		FVector Origin,
@@ -65,6 +75,8 @@ public:
 		float Angle
 	);
 
+	int32 GetEnemiesInCone(FVector Origin, FVector Direction, float Range, float Angle, TArray<AActor*>& OutEnemies);
+
 	UFUNCTION(BlueprintCallable, Category = "Searching|Area")
 	TArray<AActor*> GetEnemiesInBox(
 		FVector Center,
@@ -72,6 +84,8 @@ public:
 		FRotator Rotation = FRotator::ZeroRotator
 	);
 
+	int32 GetEnemiesInBox(FVector Center, FVector HalfExtents, FRotator Rotation, TArray<AActor*>& OutEnemies);
+
 	UFUNCTION(BlueprintCallable, Category = "Searching|Utility")
 	TArray<FRotator> CalculateSpreadRotations(
 		FRotator BaseRotation,
@@ -0,0 +1,113 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CC_SkillEffectorPoolSubsystem.h"
+#include "SkillSystem/CC_SkillEffector.h"
+#include "Engine/World.h"
+#include "CC_Stats.h"
+
+void UCC_SkillEffectorPoolSubsystem::Deinitialize()
+{
+	// Actors go with the world
+	Pools.Empty();
+	TotalPooled = 0;
+	SET_DWORD_STAT(STAT_CC_EffectorPoolSize, 0);
+
+	UE_LOG(LogTemp, Log, TEXT("Skill effector pool deinitialized (Hits: %d, Misses: %d)"), HitCount, MissCount);
+
+	Super::Deinitialize();
+}
+
+UCC_SkillEffectorPoolSubsystem* UCC_SkillEffectorPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull))
+	{
+		return World->GetSubsystem<UCC_SkillEffectorPoolSubsystem>();
+	}
+	return nullptr;
+}
+
+ACC_SkillEffector* UCC_SkillEffectorPoolSubsystem::AcquireEffector(TSubclassOf<ACC_SkillEffector> EffectorClass, FName SkillID, const FVector& Location, const FRotator& Rotation, AActor* EffectorOwner)
+{
+	if (!EffectorClass)
+	{
+		return nullptr;
+	}
+
+	if (FCC_SkillEffectorPoolList* Pool = Pools.Find(SkillID))
+	{
+		while (Pool->Effectors.Num() > 0)
+		{
+			ACC_SkillEffector* Effector = Pool->Effectors.Pop(EAllowShrinking::No);
+			--TotalPooled;
+
+			if (!IsValid(Effector))
+			{
+				continue;
+			}
+
+			// Skill now fired through a different effector class - its VFX stack does not fit
+			if (Effector->GetClass() != EffectorClass)
+			{
+				Effector->Destroy();
+				continue;
+			}
+
+			Effector->SetOwner(EffectorOwner);
+			Effector->SetInstigator(Cast<APawn>(EffectorOwner));
+			Effector->ActivateFromPool(Location, Rotation);
+
+			++HitCount;
+			INC_DWORD_STAT(STAT_CC_EffectorPoolHits);
+			SET_DWORD_STAT(STAT_CC_EffectorPoolSize, TotalPooled);
+			return Effector;
+		}
+	}
+
+	++MissCount;
+	INC_DWORD_STAT(STAT_CC_EffectorPoolMisses);
+	return SpawnEffector(EffectorClass, Location, Rotation, EffectorOwner);
+}
+
+void UCC_SkillEffectorPoolSubsystem::ReleaseEffector(ACC_SkillEffector* Effector)
+{
+	if (!IsValid(Effector) || Effector->IsPooled())
+	{
+		return;
+	}
+
+	Effector->DeactivateToPool();
+
+	FCC_SkillEffectorPoolList& Pool = Pools.FindOrAdd(Effector->GetSkillID());
+	if (Pool.Effectors.Num() >= MaxPooledPerSkill)
+	{
+		Effector->Destroy();
+		return;
+	}
+
+	Pool.Effectors.Add(Effector);
+	++TotalPooled;
+	SET_DWORD_STAT(STAT_CC_EffectorPoolSize, TotalPooled);
+}
+
+int32 UCC_SkillEffectorPoolSubsystem::GetPooledCount(FName SkillID) const
+{
+	const FCC_SkillEffectorPoolList* Pool = Pools.Find(SkillID);
+	return Pool ? Pool->Effectors.Num() : 0;
+}
+
+ACC_SkillEffector* UCC_SkillEffectorPoolSubsystem::SpawnEffector(TSubclassOf<ACC_SkillEffector> EffectorClass, const FVector& Location, const FRotator& Rotation, AActor* EffectorOwner) const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = EffectorOwner;
+	SpawnParams.Instigator = Cast<APawn>(EffectorOwner);
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	return World->SpawnActor<ACC_SkillEffector>(EffectorClass, Location, Rotation, SpawnParams);
+}
@@ -0,0 +1,67 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CC_SkillEffectorPoolSubsystem.generated.h"
+
+class ACC_SkillEffector;
+
+// Inactive effectors of one skill, ready for reuse
+USTRUCT()
+struct FCC_SkillEffectorPoolList
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<ACC_SkillEffector*> Effectors;
+};
+
+/**
+ * Per-skill pool of ACC_SkillEffector actors
+ * Pooled by SkillID so a reused effector comes back with the Niagara components (VFXStack) the
+ * same skill built last time - they are reset, not recreated (ACC_SkillEffector::ActivateFromPool).
+ */
+UCLASS()
+class CRISTALCUBE_API UCC_SkillEffectorPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintPure, Category = "Skill Effector Pool", meta = (WorldContext = "WorldContextObject"))
+	static UCC_SkillEffectorPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	// Pooled effector of the skill (hit) or a new one (miss), active at the transform - call Initialize next
+	UFUNCTION(BlueprintCallable, Category = "Skill Effector Pool")
+	ACC_SkillEffector* AcquireEffector(TSubclassOf<ACC_SkillEffector> EffectorClass, FName SkillID, const FVector& Location, const FRotator& Rotation, AActor* EffectorOwner);
+
+	// Switch off and park under its skill (destroyed when the skill is at MaxPooledPerSkill)
+	UFUNCTION(BlueprintCallable, Category = "Skill Effector Pool")
+	void ReleaseEffector(ACC_SkillEffector* Effector);
+
+	UFUNCTION(BlueprintPure, Category = "Skill Effector Pool")
+	int32 GetPooledCount(FName SkillID) const;
+
+	UFUNCTION(BlueprintPure, Category = "Skill Effector Pool")
+	int32 GetHitCount() const { return HitCount; }
+
+	UFUNCTION(BlueprintPure, Category = "Skill Effector Pool")
+	int32 GetMissCount() const { return MissCount; }
+
+protected:
+	ACC_SkillEffector* SpawnEffector(TSubclassOf<ACC_SkillEffector> EffectorClass, const FVector& Location, const FRotator& Rotation, AActor* EffectorOwner) const;
+
+	UPROPERTY()
+	TMap<FName, FCC_SkillEffectorPoolList> Pools;
+
+	// Parked effectors beyond this are destroyed on release
+	UPROPERTY(EditAnywhere, Category = "Skill Effector Pool", meta = (ClampMin = "0"))
+	int32 MaxPooledPerSkill = 128;
+
+	int32 TotalPooled = 0;
+	int32 HitCount = 0;
+	int32 MissCount = 0;
+};
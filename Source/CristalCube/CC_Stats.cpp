@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CC_Stats.h"
+
+DEFINE_STAT(STAT_CC_QueryAllocations);
+DEFINE_STAT(STAT_CC_TargetCacheHits);
+DEFINE_STAT(STAT_CC_TargetCacheMisses);
+DEFINE_STAT(STAT_CC_TargetCacheHitRate);
+
+DEFINE_STAT(STAT_CC_NearestQuery);
+DEFINE_STAT(STAT_CC_KNearestQuery);
+DEFINE_STAT(STAT_CC_ShapeQuery);
+DEFINE_STAT(STAT_CC_RandomQuery);
+DEFINE_STAT(STAT_CC_BatchResolve);
+DEFINE_STAT(STAT_CC_SpatialRebuild);
+
+DEFINE_STAT(STAT_CC_NearestQueries);
+DEFINE_STAT(STAT_CC_KNearestQueries);
+DEFINE_STAT(STAT_CC_ShapeQueries);
+DEFINE_STAT(STAT_CC_RandomQueries);
+DEFINE_STAT(STAT_CC_BatchedQueries);
+
+DEFINE_STAT(STAT_CC_QueryCandidates);
+DEFINE_STAT(STAT_CC_QueryResults);
+
+DEFINE_STAT(STAT_CC_AISteering);
+DEFINE_STAT(STAT_CC_AISteeredEnemies);
+
+DEFINE_STAT(STAT_CC_AILODUpdate);
+DEFINE_STAT(STAT_CC_AISteeringNear);
+DEFINE_STAT(STAT_CC_AISteeringMid);
+DEFINE_STAT(STAT_CC_AISteeringFar);
+DEFINE_STAT(STAT_CC_AITierNear);
+DEFINE_STAT(STAT_CC_AITierMid);
+DEFINE_STAT(STAT_CC_AITierFar);
+DEFINE_STAT(STAT_CC_AITierSleeping);
+DEFINE_STAT(STAT_CC_AISteeringSolves);
+
+DEFINE_STAT(STAT_CC_AIFlowField);
+
+DEFINE_STAT(STAT_CC_AIMovement);
+
+DEFINE_STAT(STAT_CC_AIProxyMovement);
+DEFINE_STAT(STAT_CC_AIProxies);
+DEFINE_STAT(STAT_CC_AIHydrations);
+DEFINE_STAT(STAT_CC_AIDehydrations);
+
+DEFINE_STAT(STAT_CC_AIDecisions);
+DEFINE_STAT(STAT_CC_AIStaleDecisions);
+DEFINE_STAT(STAT_CC_AIDecisionBacklog);
+DEFINE_STAT(STAT_CC_AIBudgetOverruns);
+
+DEFINE_STAT(STAT_CC_EnemyPoolHits);
+DEFINE_STAT(STAT_CC_EnemyPoolMisses);
+DEFINE_STAT(STAT_CC_EnemyPoolSize);
+
+DEFINE_STAT(STAT_CC_ProjectilePoolHits);
+DEFINE_STAT(STAT_CC_ProjectilePoolMisses);
+DEFINE_STAT(STAT_CC_ProjectilePoolSize);
+
+DEFINE_STAT(STAT_CC_EffectorPoolHits);
+DEFINE_STAT(STAT_CC_EffectorPoolMisses);
+DEFINE_STAT(STAT_CC_EffectorPoolSize);
+
+DEFINE_STAT(STAT_CC_RegisteredEnemies);
+
+DEFINE_STAT(STAT_CC_GemUpdate);
+DEFINE_STAT(STAT_CC_GemsActive);
+DEFINE_STAT(STAT_CC_GemPoolHits);
+DEFINE_STAT(STAT_CC_GemPoolMisses);
+DEFINE_STAT(STAT_CC_GemPoolSize);
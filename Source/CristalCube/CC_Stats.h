@@ -0,0 +1,138 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+//==============================================================================
+// CristalCube stats ("stat CristalCube" in the console)
+//==============================================================================
+
+DECLARE_STATS_GROUP(TEXT("CristalCube"), STATGROUP_CristalCube, STATCAT_Advanced);
+
+// Heap allocations made by enemy query result / scratch buffers this frame
+// (steady state should be 0 - every attack path reuses its buffers)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Query Allocations"), STAT_CC_QueryAllocations, STATGROUP_CristalCube, CRISTALCUBE_API);
+
+// Per-querier target cache (auto-aim should be mostly hits)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Target Cache Hits"), STAT_CC_TargetCacheHits, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Target Cache Misses"), STAT_CC_TargetCacheMisses, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Target Cache Hit Rate (%)"), STAT_CC_TargetCacheHitRate, STATGROUP_CristalCube, CRISTALCUBE_API);
+
+//==============================================================================
+// Enemy queries (ACC_EnemyManager)
+//==============================================================================
+
+// Time per query type
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Query: Nearest"), STAT_CC_NearestQuery, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Query: K-Nearest"), STAT_CC_KNearestQuery, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Query: Shape"), STAT_CC_ShapeQuery, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Query: Random"), STAT_CC_RandomQuery, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Query: Batch Resolve"), STAT_CC_BatchResolve, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spatial Hash Rebuild"), STAT_CC_SpatialRebuild, STATGROUP_CristalCube, CRISTALCUBE_API);
+
+// Queries per frame, per type
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Nearest Queries"), STAT_CC_NearestQueries, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("K-Nearest Queries"), STAT_CC_KNearestQueries, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Shape Queries"), STAT_CC_ShapeQueries, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Random Queries"), STAT_CC_RandomQueries, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Batched Queries"), STAT_CC_BatchedQueries, STATGROUP_CristalCube, CRISTALCUBE_API);
+
+// Snapshot entries distance-tested (cells visited) / enemies handed back
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Query Candidates"), STAT_CC_QueryCandidates, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Query Results"), STAT_CC_QueryResults, STATGROUP_CristalCube, CRISTALCUBE_API);
+
+//==============================================================================
+// Enemy AI (UCC_AIManager)
+//==============================================================================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI: Steering"), STAT_CC_AISteering, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI: Steered Enemies"), STAT_CC_AISteeredEnemies, STATGROUP_CristalCube, CRISTALCUBE_API);
+
+// LOD tiers - steering time and size per tier, re-solves this frame
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI: LOD Update"), STAT_CC_AILODUpdate, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI: Steering Near"), STAT_CC_AISteeringNear, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI: Steering Mid"), STAT_CC_AISteeringMid, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI: Steering Far"), STAT_CC_AISteeringFar, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("AI: Near Enemies"), STAT_CC_AITierNear, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("AI: Mid Enemies"), STAT_CC_AITierMid, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("AI: Far Enemies"), STAT_CC_AITierFar, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("AI: Sleeping Enemies"), STAT_CC_AITierSleeping, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI: Steering Solves"), STAT_CC_AISteeringSolves, STATGROUP_CristalCube, CRISTALCUBE_API);
+
+// Shared pursuit field (rebuilds only when the player changes cell)
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI: Flow Field Rebuild"), STAT_CC_AIFlowField, STATGROUP_CristalCube, CRISTALCUBE_API);
+
+// Lightweight enemy movement moved by the AI manager
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI: Lightweight Movement"), STAT_CC_AIMovement, STATGROUP_CristalCube, CRISTALCUBE_API);
+
+// Far enemies kept as proxies (no actor) - update pass, count, actors created from / returned to proxies this frame
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI: Proxy Movement"), STAT_CC_AIProxyMovement, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("AI: Proxy Enemies"), STAT_CC_AIProxies, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI: Hydrations"), STAT_CC_AIHydrations, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI: Dehydrations"), STAT_CC_AIDehydrations, STATGROUP_CristalCube, CRISTALCUBE_API);
+
+// Time-sliced decisions - processed / forced by staleness this frame, due but left for later, frames over budget
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI: Decisions"), STAT_CC_AIDecisions, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI: Stale Decisions (forced)"), STAT_CC_AIStaleDecisions, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("AI: Decision Backlog"), STAT_CC_AIDecisionBacklog, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("AI: Budget Overruns"), STAT_CC_AIBudgetOverruns, STATGROUP_CristalCube, CRISTALCUBE_API);
+
+//==============================================================================
+// Enemy actor pool (UCC_EnemyPoolSubsystem)
+//==============================================================================
+
+// Acquires served from the pool / spawned, enemies parked right now
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Enemy Pool: Hits"), STAT_CC_EnemyPoolHits, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Enemy Pool: Misses"), STAT_CC_EnemyPoolMisses, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Enemy Pool: Pooled"), STAT_CC_EnemyPoolSize, STATGROUP_CristalCube, CRISTALCUBE_API);
+
+// Same for projectiles (UCC_ProjectilePoolSubsystem)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Projectile Pool: Hits"), STAT_CC_ProjectilePoolHits, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Projectile Pool: Misses"), STAT_CC_ProjectilePoolMisses, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Projectile Pool: Pooled"), STAT_CC_ProjectilePoolSize, STATGROUP_CristalCube, CRISTALCUBE_API);
+
+// Skill effectors (UCC_SkillEffectorPoolSubsystem) - a miss also means new Niagara components
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Effector Pool: Hits"), STAT_CC_EffectorPoolHits, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Effector Pool: Misses"), STAT_CC_EffectorPoolMisses, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Effector Pool: Pooled"), STAT_CC_EffectorPoolSize, STATGROUP_CristalCube, CRISTALCUBE_API);
+
+// Enemy lives with a handle in UCC_EnemyRegistry (actor-backed, pooled ones excluded)
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Registered Enemies"), STAT_CC_RegisteredEnemies, STATGROUP_CristalCube, CRISTALCUBE_API);
+
+// Experience gems (UCC_ExperienceGemPoolSubsystem) and their batched update
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Gem Update"), STAT_CC_GemUpdate, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Gems Active"), STAT_CC_GemsActive, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Gem Pool: Hits"), STAT_CC_GemPoolHits, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Gem Pool: Misses"), STAT_CC_GemPoolMisses, STATGROUP_CristalCube, CRISTALCUBE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Gem Pool: Pooled"), STAT_CC_GemPoolSize, STATGROUP_CristalCube, CRISTALCUBE_API);
+
+/**
+ * Counts a query buffer that had to grow while in scope
+ * Put it next to the buffer before filling it - a by-value result always counts once.
+ */
+template<typename ArrayType>
+class TCC_QueryAllocationScope
+{
+public:
+    explicit TCC_QueryAllocationScope(const ArrayType& InArray)
+        : Array(InArray)
+        , InitialMax(InArray.Max())
+    {
+    }
+
+    ~TCC_QueryAllocationScope()
+    {
+        if (Array.Max() > InitialMax)
+        {
+            INC_DWORD_STAT(STAT_CC_QueryAllocations);
+        }
+    }
+
+private:
+    const ArrayType& Array;
+    int32 InitialMax;
+};
+
+#define CC_SCOPE_QUERY_ALLOCATIONS(Array) TCC_QueryAllocationScope<std::decay_t<decltype(Array)>> ANONYMOUS_VARIABLE(QueryAllocationScope)(Array)
@@ -4,6 +4,7 @@
 #include "CC_TileManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Gameplay/CC_Tile.h"
+#include "CC_EnemyManager.h"
 
 ACC_TileManager* ACC_TileManager::Instance = nullptr;
 // Sets default values
@@ -23,6 +24,12 @@ void ACC_TileManager::BeginPlay()
 
 	GenerateTileGrid();
 
+	//  ˻ ȯ (HandleWrapAround  ֱ)
+	if (ACC_EnemyManager* EnemyManager = ACC_EnemyManager::Get(this))
+	{
+		EnemyManager->SetWorldWrap(GetActorLocation(), FVector2D(TileSize * 3, TileSize * 3));
+	}
+
 	UE_LOG(LogTemp, Warning, TEXT("[TileManager] Initialized - 3x3 Grid Created"));	
 }
 
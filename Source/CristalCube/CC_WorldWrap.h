@@ -0,0 +1,119 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Toroidal XY domain (3x3 tile grid / cube wrap)
+ * Actors crossing an edge are teleported by Period, so two points are as close as their
+ * closest images (minimum-image convention). Z never wraps.
+ */
+struct FCC_WorldWrap
+{
+    // Up to the own image plus the 8 neighbours
+    static constexpr int32 MaxImages = 9;
+
+    bool bEnabled = false;
+
+    FVector2D Center = FVector2D::ZeroVector;
+    FVector2D Period = FVector2D::ZeroVector;
+
+    bool IsEnabled() const { return bEnabled; }
+
+    void Set(const FVector& InCenter, const FVector2D& InPeriod)
+    {
+        Center = FVector2D(InCenter.X, InCenter.Y);
+        Period = InPeriod;
+        bEnabled = InPeriod.X > 0.0 && InPeriod.Y > 0.0;
+    }
+
+    void Reset()
+    {
+        bEnabled = false;
+    }
+
+    // To - From with XY folded onto the closest image (|X|, |Y| <= Period / 2)
+    FVector MinimumImageDelta(const FVector& From, const FVector& To) const
+    {
+        FVector Delta = To - From;
+        if (bEnabled)
+        {
+            Delta.X -= Period.X * FMath::RoundToDouble(Delta.X / Period.X);
+            Delta.Y -= Period.Y * FMath::RoundToDouble(Delta.Y / Period.Y);
+        }
+        return Delta;
+    }
+
+    float DistSquared(const FVector& From, const FVector& To) const
+    {
+        return MinimumImageDelta(From, To).SizeSquared();
+    }
+
+    // Location moved into the domain (where a wall teleport would have put an actor)
+    FVector Fold(const FVector& Location) const
+    {
+        if (!bEnabled)
+        {
+            return Location;
+        }
+
+        return FVector(Center.X, Center.Y, 0.0) + MinimumImageDelta(FVector(Center.X, Center.Y, 0.0), FVector(Location.X, Location.Y, 0.0))
+            + FVector(0.0, 0.0, Location.Z);
+    }
+
+    // Image of To closest to From (aim here, not at To)
+    FVector NearestImage(const FVector& From, const FVector& To) const
+    {
+        return From + MinimumImageDelta(From, To);
+    }
+
+    /**
+     * Origin offsets under which a query of Radius around Location overlaps the domain
+     * Searching at Location + Offset is the same as searching the enemies' image at -Offset.
+     * The zero offset always comes first.
+     * @return Number of offsets written (1 when wrap is off)
+     */
+    int32 GetQueryOffsets(const FVector& Location, float Radius, FVector (&OutOffsets)[MaxImages]) const
+    {
+        OutOffsets[0] = FVector::ZeroVector;
+        if (!bEnabled)
+        {
+            return 1;
+        }
+
+        const FVector2D DomainMin = Center - Period * 0.5;
+        const FVector2D DomainMax = Center + Period * 0.5;
+
+        int32 NumOffsets = 1;
+        for (int32 KX = -1; KX <= 1; ++KX)
+        {
+            for (int32 KY = -1; KY <= 1; ++KY)
+            {
+                if (KX == 0 && KY == 0)
+                {
+                    continue;
+                }
+
+                const double X = Location.X + KX * Period.X;
+                const double Y = Location.Y + KY * Period.Y;
+
+                if (X + Radius < DomainMin.X || X - Radius > DomainMax.X ||
+                    Y + Radius < DomainMin.Y || Y - Radius > DomainMax.Y)
+                {
+                    continue;
+                }
+
+                OutOffsets[NumOffsets++] = FVector(KX * Period.X, KY * Period.Y, 0.0);
+            }
+        }
+
+        return NumOffsets;
+    }
+
+    // A query this wide can see the same enemy through two images (results need dedup)
+    bool CanOverlapImages(float Radius) const
+    {
+        return bEnabled && 2.0 * Radius >= FMath::Min(Period.X, Period.Y);
+    }
+};
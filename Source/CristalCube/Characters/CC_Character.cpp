@@ -5,7 +5,8 @@
 #include "GameFramework/CharacterMovementComponent.h"
 
 // Sets default values
-ACC_Character::ACC_Character()
+ACC_Character::ACC_Character(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
 {
  	// Set this character to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
 	PrimaryActorTick.bCanEverTick = true;
@@ -84,10 +85,15 @@ void ACC_Character::Die()
 	FTimerHandle DestroyTimer;
 	GetWorld()->GetTimerManager().SetTimer(DestroyTimer, [this]()
 		{
-			Destroy();
+			FinishDeath();
 		}, 0.5f, false);
 }
 
+void ACC_Character::FinishDeath()
+{
+	Destroy();
+}
+
 float ACC_Character::Heal(float HealAmount)
 {
 	// Input validation
@@ -13,7 +13,8 @@ class CRISTALCUBE_API ACC_Character : public ACharacter
 
 public:
 	// Sets default values for this character's properties
-	ACC_Character();
+	// (ObjectInitializer lets subclasses swap default subobjects, e.g. the movement component)
+	ACC_Character(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 protected:
 	// Called when the game starts or when spawned
@@ -65,4 +66,7 @@ public:
 protected:
 
 	virtual void ApplyStats();
+
+	// End of the death delay - destroys the actor (pooled characters release it instead)
+	virtual void FinishDeath();
 };
@@ -6,6 +6,8 @@
 #include "Kismet/GameplayStatics.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SphereComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/Controller.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Animation/AnimInstance.h"
 #include "Animation/AnimMontage.h"
@@ -15,9 +17,15 @@
 #include "../CC_EnemyManager.h"
 #include "../CC_AIManager.h"
 #include "../CC_EnemyAIController.h"
+#include "../CC_EnemyMovementComponent.h"
+#include "../CC_EnemyPoolSubsystem.h"
+#include "../CC_EnemySpawner.h"
 #include "../Gameplay/CC_ExperienceGem.h"
+#include "../CC_ExperienceGemPoolSubsystem.h"
+#include "../CC_EnemyRegistry.h"
 
-ACC_EnemyCharacter::ACC_EnemyCharacter()
+ACC_EnemyCharacter::ACC_EnemyCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UCC_EnemyMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
 	PrimaryActorTick.bCanEverTick = true;
 
@@ -63,7 +71,9 @@ ACC_EnemyCharacter::ACC_EnemyCharacter()
 	// Reward settings
 	ExperienceDrop = 10.0f;    // Give 10 XP when killed
 
-	AutoPossessAI = EAutoPossessAI::PlacedInWorldOrSpawned;
+	// Possessed only when the stats ask for a controller (BeginPlay) - steering comes from UCC_AIManager
+	AutoPossessAI = EAutoPossessAI::Disabled;
+	AIControllerClass = ACC_EnemyAIController::StaticClass();
 
 	// Enemy type
 	EnemyType = TEXT("Basic");
@@ -72,11 +82,21 @@ ACC_EnemyCharacter::ACC_EnemyCharacter()
 
 void ACC_EnemyCharacter::BeginPlay()
 {
+	// Before components begin play - trackers may register the enemy with a tile right away
+	AcquireEnemyHandle();
+
 	Super::BeginPlay();
 
-	if (!GetController())
+	// Before registering with the AI manager, which drives lightweight movement itself
+	if (UCC_EnemyMovementComponent* EnemyMovement = Cast<UCC_EnemyMovementComponent>(GetCharacterMovement()))
+	{
+		EnemyMovement->SetLightweight(!EnemyStats.bFullCharacterMovement);
+	}
+
+	if (EnemyStats.bUseAIController && !GetController())
 	{
-		CC_LOG_ENEMY(Warning, TEXT("No controller! Spawning AI Controller..."));
+		SpawnDefaultController();
+		CC_LOG_ENEMY(Log, TEXT("%s possessed by %s"), *GetName(), GetController() ? *GetController()->GetName() : TEXT("nothing"));
 	}
 
 	// Add "Enemy" tag for weapon auto-aim
@@ -107,17 +127,6 @@ void ACC_EnemyCharacter::BeginPlay()
 		CC_LOG_ENEMY(Warning, TEXT("%s - Attack range sphere initialized (Radius: %.1f)"), *GetName(), AttackRangeSphere->GetScaledSphereRadius());
 	}
 
-	if (UCC_AIManager* AIManager = UCC_AIManager::Get(this))
-	{
-		AIManager->RegisterEnemy(this);
-		UE_LOG(LogTemp, Log, TEXT("Enemy registered with AI Manager: %s"), *GetName());
-	}
-	else
-	{
-		UE_LOG(LogTemp, Warning, TEXT("AI Manager not found, using fallback AI for: %s"), *GetName());
-		// Fallback:    (AI Manager    )
-	}
-
 	if (USkeletalMeshComponent* SkeletalMesh = GetMesh())
 	{
 		if (UAnimInstance* AnimInstance = SkeletalMesh->GetAnimInstance())
@@ -137,13 +146,69 @@ void ACC_EnemyCharacter::BeginPlay()
 		}
 	}
 
+	RegisterWithManagers();
+}
+
+void ACC_EnemyCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Deactivated enemies (pooled, proxy, frozen cube) are already unregistered
+	if (!bDeactivated)
+	{
+		UnregisterFromManagers();
+	}
+
+	ReleaseEnemyHandle();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ACC_EnemyCharacter::AcquireEnemyHandle()
+{
+	UCC_EnemyRegistry* Registry = UCC_EnemyRegistry::Get(this);
+	if (!Registry)
+	{
+		return;
+	}
+
+	// A reused body is a new enemy - whoever still holds the old handle sees it go stale
+	Registry->Unregister(EnemyHandle);
+	EnemyHandle = Registry->Register(this);
+}
+
+void ACC_EnemyCharacter::ReleaseEnemyHandle()
+{
+	if (!EnemyHandle.IsSet())
+	{
+		return;
+	}
+
+	if (UCC_EnemyRegistry* Registry = UCC_EnemyRegistry::Get(this))
+	{
+		Registry->Unregister(EnemyHandle);
+	}
+	EnemyHandle.Reset();
+}
+
+void ACC_EnemyCharacter::RegisterWithManagers()
+{
+	if (UCC_AIManager* AIManager = UCC_AIManager::Get(this))
+	{
+		AIManager->RegisterEnemy(this);
+		UE_LOG(LogTemp, Log, TEXT("Enemy registered with AI Manager: %s"), *GetName());
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AI Manager not found, using fallback AI for: %s"), *GetName());
+		// Fallback:    (AI Manager    )
+	}
+
 	if (ACC_EnemyManager* Manager = ACC_EnemyManager::Get(this))
 	{
 		Manager->RegisterEnemy(this);
 	}
 }
 
-void ACC_EnemyCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+void ACC_EnemyCharacter::UnregisterFromManagers()
 {
 	// Unregister from AI Manager
 	if (UCC_AIManager* AIManager = UCC_AIManager::Get(this))
@@ -155,14 +220,131 @@ void ACC_EnemyCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	{
 		Manager->UnregisterEnemy(this);
 	}
+}
 
-	Super::EndPlay(EndPlayReason);
+bool ACC_EnemyCharacter::CanDehydrate() const
+{
+	return !bDeactivated && IsAlive() && !bIsAttacking && !EnemyStats.bFullCharacterMovement;
+}
+
+void ACC_EnemyCharacter::DeactivateEnemy()
+{
+	if (bDeactivated)
+	{
+		return;
+	}
+
+	// Out of every manager first (wakes a sleeping enemy), then switch everything off
+	UnregisterFromManagers();
+	bDeactivated = true;
+
+	GetWorldTimerManager().ClearTimer(AttackCooldownTimer);
+	bIsAttacking = false;
+	bPlayerInRange = false;
+	bCanAttack = true;
+	bChasePlayer = false;
+
+	SetDormant(true);
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+}
+
+void ACC_EnemyCharacter::ActivateEnemy()
+{
+	if (!bDeactivated)
+	{
+		return;
+	}
+
+	bDeactivated = false;
+
+	SetActorHiddenInGame(false);
+	SetDormant(false);
+
+	// Frozen mid-death: visible again until its death timer releases it, but not a target
+	if (!IsAlive())
+	{
+		return;
+	}
+
+	SetActorEnableCollision(true);
+	RegisterWithManagers();
+}
+
+void ACC_EnemyCharacter::ResetForReuse(const FVector& Location, const FRotator& Rotation)
+{
+	AcquireEnemyHandle();
+
+	SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+
+	// Everything the last life may have changed goes back to the class defaults (same as a fresh spawn)
+	const ACC_EnemyCharacter* Defaults = GetClass()->GetDefaultObject<ACC_EnemyCharacter>();
+
+	// Health and stats
+	MaxHealth = Defaults->MaxHealth;
+	MoveSpeed = Defaults->MoveSpeed;
+	CurrentHealth = MaxHealth;
+	EnemyStats = Defaults->EnemyStats;
+	DetectionRange = Defaults->DetectionRange;
+	AttackHitData = Defaults->AttackHitData;
+	ContactDamage = Defaults->ContactDamage;
+	DamageCooldown = Defaults->DamageCooldown;
+
+	// Reward
+	ExperienceDrop = Defaults->ExperienceDrop;
+	ExpGemClass = Defaults->ExpGemClass;
+	ExpGemAmount = Defaults->ExpGemAmount;
+
+	// Combat and AI state
+	GetWorldTimerManager().ClearTimer(AttackCooldownTimer);
+	bIsAttacking = false;
+	bPlayerInRange = false;
+	bCanAttack = true;
+	bChasePlayer = Defaults->bChasePlayer;
+	LastDamageTime = 0.0f;
+	SpawnSource = nullptr;
+
+	// Tags added during the last life are dropped
+	Tags = Defaults->Tags;
+	Tags.AddUnique(FName("Enemy"));
+
+	// Whatever Die() and a frozen cube switched off
+	CustomTimeDilation = 1.0f;
+
+	if (USkeletalMeshComponent* SkeletalMesh = GetMesh())
+	{
+		SkeletalMesh->bPauseAnims = false;
+
+		if (UAnimInstance* AnimInstance = SkeletalMesh->GetAnimInstance())
+		{
+			AnimInstance->StopAllMontages(0.0f);
+		}
+	}
+
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		Movement->StopMovementImmediately();
+		Movement->SetMovementMode(MOVE_Walking);
+		Movement->MaxWalkSpeed = Defaults->GetCharacterMovement()->MaxWalkSpeed;
+
+		// Teleported to a new spawn - trace the floor again instead of keeping the old one
+		if (UCC_EnemyMovementComponent* EnemyMovement = Cast<UCC_EnemyMovementComponent>(Movement))
+		{
+			EnemyMovement->ResetGroundHeight();
+		}
+	}
+}
+
+void ACC_EnemyCharacter::ApplyProxyHealth(float Health)
+{
+	CurrentHealth = FMath::Clamp(Health, KINDA_SMALL_NUMBER, MaxHealth);
 }
 
 void ACC_EnemyCharacter::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	// Fallback only - UCC_AIManager disables this tick and steers registered enemies in one batch
 	// Chase player if enabled and alive
 	if (bChasePlayer && IsAlive() && !bIsAttacking)
 	{
@@ -219,6 +401,115 @@ void ACC_EnemyCharacter::FindPlayer()
 	}
 }
 
+void ACC_EnemyCharacter::SetIgnoreEnemyCollision(bool bIgnore)
+{
+	UCapsuleComponent* Capsule = GetCapsuleComponent();
+	if (!Capsule)
+	{
+		return;
+	}
+
+	if (bIgnore)
+	{
+		// Enemy channel: other enemies pass through, Pawn (player) and world still block
+		Capsule->SetCollisionObjectType(ECC_GameTraceChannel1);
+		Capsule->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Ignore);
+	}
+	else
+	{
+		// Constructor defaults - enemies block each other as Pawns
+		Capsule->SetCollisionObjectType(ECC_Pawn);
+		Capsule->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Overlap);
+	}
+}
+
+void ACC_EnemyCharacter::SetDormant(bool bNewDormant)
+{
+	if (bDormant == bNewDormant)
+	{
+		return;
+	}
+
+	bDormant = bNewDormant;
+
+	UCharacterMovementComponent* Movement = GetCharacterMovement();
+	USkeletalMeshComponent* SkeletalMesh = GetMesh();
+	UCapsuleComponent* Capsule = GetCapsuleComponent();
+	AController* EnemyController = GetController();
+
+	if (bDormant)
+	{
+		// Remember what was running, then switch all of it off
+		bDormantActorTick = IsActorTickEnabled();
+		bDormantControllerTick = EnemyController && EnemyController->IsActorTickEnabled();
+		bDormantMovementTick = Movement && Movement->IsComponentTickEnabled();
+		bDormantMeshTick = SkeletalMesh && SkeletalMesh->IsComponentTickEnabled();
+		bDormantCapsuleOverlaps = Capsule && Capsule->GetGenerateOverlapEvents();
+		bDormantAttackRangeOverlaps = AttackRangeSphere && AttackRangeSphere->GetGenerateOverlapEvents();
+
+		SetActorTickEnabled(false);
+
+		if (EnemyController)
+		{
+			EnemyController->SetActorTickEnabled(false);
+		}
+
+		// No floor checks or leftover velocity while asleep
+		if (Movement)
+		{
+			Movement->StopMovementImmediately();
+			Movement->SetComponentTickEnabled(false);
+		}
+
+		if (SkeletalMesh)
+		{
+			SkeletalMesh->SetComponentTickEnabled(false);
+		}
+
+		if (Capsule)
+		{
+			Capsule->SetGenerateOverlapEvents(false);
+		}
+
+		if (AttackRangeSphere)
+		{
+			AttackRangeSphere->SetGenerateOverlapEvents(false);
+		}
+
+		return;
+	}
+
+	// Wake - everything back before the next tick, overlaps refreshed for whatever moved in meanwhile
+	if (Capsule)
+	{
+		Capsule->SetGenerateOverlapEvents(bDormantCapsuleOverlaps);
+	}
+
+	if (AttackRangeSphere)
+	{
+		AttackRangeSphere->SetGenerateOverlapEvents(bDormantAttackRangeOverlaps);
+	}
+
+	if (SkeletalMesh)
+	{
+		SkeletalMesh->SetComponentTickEnabled(bDormantMeshTick);
+	}
+
+	if (Movement)
+	{
+		Movement->SetComponentTickEnabled(bDormantMovementTick);
+	}
+
+	if (EnemyController)
+	{
+		EnemyController->SetActorTickEnabled(bDormantControllerTick);
+	}
+
+	SetActorTickEnabled(bDormantActorTick);
+
+	UpdateOverlaps();
+}
+
 bool ACC_EnemyCharacter::CanDealDamage() const
 {
 	float CurrentTime = GetWorld()->GetTimeSeconds();
@@ -483,17 +774,13 @@ void ACC_EnemyCharacter::Die()
 		);
 
 		FVector SpawnLocation = BaseLocation + Offset;
-		FRotator SpawnRotation = FRotator::ZeroRotator;
 
-		ACC_ExperienceGem* Gem = GetWorld()->SpawnActor<ACC_ExperienceGem>(
-			ExpGemClass,
-			SpawnLocation,
-			SpawnRotation
-		);
+		// Pooled gem when one is free, a new actor otherwise
+		UCC_ExperienceGemPoolSubsystem* GemPool = UCC_ExperienceGemPoolSubsystem::Get(this);
+		ACC_ExperienceGem* Gem = GemPool ? GemPool->AcquireGem(ExpGemClass, SpawnLocation, ExpGemAmount) : nullptr;
 
 		if (Gem)
 		{
-			Gem->SetExpAmount(ExpGemAmount);
 			CC_LOG_ENEMY(Log, TEXT("[Enemy] Spawned EXP Gem (%f EXP)"), ExpGemAmount);
 		}
 	}
@@ -507,13 +794,34 @@ void ACC_EnemyCharacter::Die()
 		AIManager->UnregisterEnemy(this);
 	}
 
+	// Spawners stop counting it; the handle stays valid until the body is parked
+	if (UCC_EnemyRegistry* Registry = UCC_EnemyRegistry::Get(this))
+	{
+		Registry->MarkDead(EnemyHandle);
+	}
+
 	// Call base class Die() to handle death animation, etc.
 	Super::Die();
 
 	// TODO: Spawn death effect, drop items, etc.
+}
+
+void ACC_EnemyCharacter::FinishDeath()
+{
+	UCC_EnemyPoolSubsystem* Pool = UCC_EnemyPoolSubsystem::Get(this);
+	if (!Pool)
+	{
+		Super::FinishDeath();
+		return;
+	}
+
+	// Out of the spawner count and its cube before parking
+	if (ACC_EnemySpawner* Spawner = SpawnSource.Get())
+	{
+		Spawner->ReleaseEnemy(this);
+	}
 
-	// Destroy enemy after short delay
-	SetLifeSpan(1.0f);
+	Pool->ReleaseEnemy(this);
 }
 
 void ACC_EnemyCharacter::OnOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
@@ -5,8 +5,16 @@
 #include "CoreMinimal.h"
 #include "CC_Character.h"
 #include "../CristalCubeStruct.h"
+#include "../CC_EnemyRegistry.h"
 #include "CC_EnemyCharacter.generated.h"
 
+// Where UCC_AIManager keeps an enemy's tier entry (INDEX_NONE = in no bucket)
+struct FCC_AIRegistrySlot
+{
+	int32 TierIndex = INDEX_NONE;
+	uint8 Tier = 0;
+};
+
 /**
  * 
  */
@@ -16,7 +24,8 @@ class CRISTALCUBE_API ACC_EnemyCharacter : public ACC_Character
 	GENERATED_BODY()
 
 public:
-	ACC_EnemyCharacter();
+	// Basic enemies move with UCC_EnemyMovementComponent
+	ACC_EnemyCharacter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 protected:
 
@@ -105,6 +114,9 @@ protected:
 
 protected:
 
+	// Back to UCC_EnemyPoolSubsystem instead of Destroy
+	virtual void FinishDeath() override;
+
 	//==========================================================================
 	// COLLISION
 	//==========================================================================
@@ -147,8 +159,95 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Enemy|AI")
 	bool GetChasePlayer() const { return bChasePlayer; }
 
+	UFUNCTION(BlueprintPure, Category = "Enemy|AI")
+	bool IsAttacking() const { return bIsAttacking; }
+
+	UFUNCTION(BlueprintPure, Category = "Enemy|AI")
+	float GetAttackRange() const { return EnemyStats.AttackRange; }
+
+	// Gem dropped on death (spawners prewarm the gem pool with it)
+	UFUNCTION(BlueprintPure, Category = "Enemy|Reward")
+	TSubclassOf<class ACC_ExperienceGem> GetExpGemClass() const { return ExpGemClass; }
+
+	// Crowd collision mode, set by UCC_AIManager
+	// true = Enemy object channel, passes through other enemies (still blocks the player and the world)
+	void SetIgnoreEnemyCollision(bool bIgnore);
+
+	/**
+	 * Dormancy for UCC_AIManager's sleeping tier
+	 * Suspends the actor and controller tick, movement, animation and overlap generation (capsule and
+	 * attack range) in one call; waking restores exactly what was enabled before and refreshes overlaps.
+	 */
+	void SetDormant(bool bNewDormant);
+
+	UFUNCTION(BlueprintPure, Category = "Enemy|AI")
+	bool IsDormant() const { return bDormant; }
+
+	//==========================================================================
+	// Activation (UCC_EnemyPoolSubsystem: pooled, dehydrated into a proxy, frozen cube)
+	//==========================================================================
+
+	// Switch off without destroying: unregistered, attack stopped, dormant, hidden, no collision
+	void DeactivateEnemy();
+
+	// Undo DeactivateEnemy: collision, visible, awake, registered again
+	void ActivateEnemy();
+
+	UFUNCTION(BlueprintPure, Category = "Enemy|Pool")
+	bool IsEnemyActive() const { return !bDeactivated; }
+
+	// Reset hook before a pooled enemy is reused: class-default stats, rewards and tags, combat and AI state, movement, placed at Location
+	virtual void ResetForReuse(const FVector& Location, const FRotator& Rotation);
+
+	void SetPooled(bool bInPool) { bPooled = bInPool; }
+	bool IsPooled() const { return bPooled; }
+
+	// This life's UCC_EnemyRegistry handle - what spawners, cubes, tiles and managers keep
+	const FCC_EnemyHandle& GetEnemyHandle() const { return EnemyHandle; }
+
+	// New handle (spawn, pool reuse) / end the current one (parked, destroyed)
+	void AcquireEnemyHandle();
+	void ReleaseEnemyHandle();
+
+	// Health carried over from a proxy (UCC_AIManager hydration)
+	void ApplyProxyHealth(float Health);
+
+	// Bosses and enemies mid-attack stay actors
+	bool CanDehydrate() const;
+
+	void SetSpawnSource(class ACC_EnemySpawner* Spawner) { SpawnSource = Spawner; }
+	class ACC_EnemySpawner* GetSpawnSource() const { return SpawnSource.Get(); }
+
+	// UCC_AIManager bookkeeping - O(1) unregister and tier moves without searching its arrays
+	FCC_AIRegistrySlot& GetAIRegistrySlot() { return AIRegistrySlot; }
+
 protected:
 
+	// AI manager + enemy manager (BeginPlay / EndPlay and hydration)
+	void RegisterWithManagers();
+	void UnregisterFromManagers();
+
+	bool bDeactivated = false;
+	bool bPooled = false;
+
+	// Spawner that counts this enemy (kept on the proxy while dehydrated)
+	TWeakObjectPtr<class ACC_EnemySpawner> SpawnSource;
+
+	FCC_AIRegistrySlot AIRegistrySlot;
+
+	FCC_EnemyHandle EnemyHandle;
+
+	//==========================================================================
+	// Dormancy (what SetDormant(true) switched off, restored on wake)
+	//==========================================================================
+	bool bDormant = false;
+	bool bDormantActorTick = false;
+	bool bDormantControllerTick = false;
+	bool bDormantMovementTick = false;
+	bool bDormantMeshTick = false;
+	bool bDormantCapsuleOverlaps = false;
+	bool bDormantAttackRangeOverlaps = false;
+
 	//==========================================================================
 	// Attack 
 	//==========================================================================
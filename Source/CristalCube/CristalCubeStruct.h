@@ -650,11 +650,21 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
     float AttackRange; 
 
+    // Bosses: full CharacterMovement (floor sweeps, step-up) instead of the lightweight planar move
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
+    bool bFullCharacterMovement;
+
+    // Behavior tree / StateTree archetypes: possessed by an ACC_EnemyAIController. Basic enemies have no controller, the AI manager drives them
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
+    bool bUseAIController;
+
     FCristalCubeEnemyStats()
     {
         AttackDamage = 10.0f;
         AttackCooldown = 1.0f;
         AttackRange = 200.0f;
+        bFullCharacterMovement = false;
+        bUseAIController = false;
     }
 };
 
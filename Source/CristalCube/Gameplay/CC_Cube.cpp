@@ -5,6 +5,9 @@
 #include "CC_Tile.h"
 #include "CC_Freezable.h"
 #include "../CC_CubeWorldManager.h"
+#include "../CC_EnemyPoolSubsystem.h"
+#include "../CC_EnemyRegistry.h"
+#include "../Characters/CC_EnemyCharacter.h"
 #include "DrawDebugHelpers.h"
 #include "GameFramework/Character.h"
 #include "Kismet/GameplayStatics.h"
@@ -255,6 +258,7 @@ void ACC_Cube::InitializeCubeWalls()
 	CubeWall_Right->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 	CubeWall_Right->SetCollisionResponseToAllChannels(ECR_Ignore);
 	CubeWall_Right->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+	CubeWall_Right->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Overlap);
 	CubeWall_Right->SetGenerateOverlapEvents(true);
 	CubeWall_Right->ShapeColor = FColor::Red;
 
@@ -266,6 +270,7 @@ void ACC_Cube::InitializeCubeWalls()
 	CubeWall_Left->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 	CubeWall_Left->SetCollisionResponseToAllChannels(ECR_Ignore);
 	CubeWall_Left->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+	CubeWall_Left->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Overlap);
 	CubeWall_Left->SetGenerateOverlapEvents(true);
 	CubeWall_Left->ShapeColor = FColor::Blue;
 
@@ -277,6 +282,7 @@ void ACC_Cube::InitializeCubeWalls()
 	CubeWall_Top->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 	CubeWall_Top->SetCollisionResponseToAllChannels(ECR_Ignore);
 	CubeWall_Top->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+	CubeWall_Top->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Overlap);
 	CubeWall_Top->SetGenerateOverlapEvents(true);
 	CubeWall_Top->ShapeColor = FColor::Green;
 
@@ -288,6 +294,7 @@ void ACC_Cube::InitializeCubeWalls()
 	CubeWall_Bottom->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 	CubeWall_Bottom->SetCollisionResponseToAllChannels(ECR_Ignore);
 	CubeWall_Bottom->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+	CubeWall_Bottom->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Overlap);
 	CubeWall_Bottom->SetGenerateOverlapEvents(true);
 	CubeWall_Bottom->ShapeColor = FColor::Yellow;
 }
@@ -375,13 +382,35 @@ void ACC_Cube::CreateBoundaryTriggers()
 
 void ACC_Cube::RegisterActor(AActor* Actor)
 {
-	if (!Actor || ManagedActors.Contains(Actor))
+	if (!Actor)
 		return;
 
-	ManagedActors.Add(Actor);
+	//  Ʈ ڵ 
+	ACC_EnemyCharacter* Enemy = Cast<ACC_EnemyCharacter>(Actor);
+	if (Enemy && Enemy->GetEnemyHandle().IsSet())
+	{
+		if (!ManagedEnemies.Add(Enemy->GetEnemyHandle()))
+			return;
+
+		// ִ ť꿡   (Ͻ  ) - Unfreeze 
+		if (IsFrozen())
+		{
+			if (UCC_EnemyPoolSubsystem* EnemyPool = UCC_EnemyPoolSubsystem::Get(this))
+			{
+				EnemyPool->SuspendEnemy(Enemy);
+			}
+		}
+	}
+	else
+	{
+		if (ManagedActors.Contains(Actor))
+			return;
+
+		ManagedActors.Add(Actor);
+	}
 
 	UE_LOG(LogTemp, Log, TEXT("[Cube %d,%d] Registered actor: %s (Total: %d)"),
-		CubeCoordinate.X, CubeCoordinate.Y, *Actor->GetName(), ManagedActors.Num());
+		CubeCoordinate.X, CubeCoordinate.Y, *Actor->GetName(), ManagedActors.Num() + ManagedEnemies.Num());
 }
 
 void ACC_Cube::UnregisterActor(AActor* Actor)
@@ -389,10 +418,18 @@ void ACC_Cube::UnregisterActor(AActor* Actor)
 	if (!Actor)
 		return;
 
-	ManagedActors.Remove(Actor);
+	const ACC_EnemyCharacter* Enemy = Cast<ACC_EnemyCharacter>(Actor);
+	if (Enemy && Enemy->GetEnemyHandle().IsSet())
+	{
+		ManagedEnemies.Remove(Enemy->GetEnemyHandle());
+	}
+	else
+	{
+		ManagedActors.Remove(Actor);
+	}
 
 	UE_LOG(LogTemp, Log, TEXT("[Cube %d,%d] Unregistered actor: %s (Total: %d)"),
-		CubeCoordinate.X, CubeCoordinate.Y, *Actor->GetName(), ManagedActors.Num());
+		CubeCoordinate.X, CubeCoordinate.Y, *Actor->GetName(), ManagedActors.Num() + ManagedEnemies.Num());
 }
 
 bool ACC_Cube::IsActorInCube(AActor* Actor) const
@@ -417,6 +454,23 @@ void ACC_Cube::Freeze()
 	SetActorHiddenInGame(true);
 	SetActorTickEnabled(false);
 
+	// Enemies are switched off through the pool (out of AI steering and queries), state kept for Unfreeze
+	// Suspend keeps the handle, so the same handles resolve again in Unfreeze
+	UCC_EnemyPoolSubsystem* EnemyPool = UCC_EnemyPoolSubsystem::Get(this);
+	if (UCC_EnemyRegistry* Registry = UCC_EnemyRegistry::Get(this))
+	{
+		ManagedEnemies.RemoveStale(*Registry);
+
+		for (const FCC_EnemyHandle& Handle : ManagedEnemies)
+		{
+			ACC_EnemyCharacter* Enemy = Registry->Resolve(Handle);
+			if (Enemy && EnemyPool)
+			{
+				EnemyPool->SuspendEnemy(Enemy);
+			}
+		}
+	}
+
 	// Ҽ Actor Freeze
 	for (AActor* Actor : ManagedActors)
 	{
@@ -474,8 +528,8 @@ void ACC_Cube::Freeze()
 		}
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("[Cube %d,%d] FROZEN (%d actors)"),
-		CubeCoordinate.X, CubeCoordinate.Y, ManagedActors.Num());
+	UE_LOG(LogTemp, Warning, TEXT("[Cube %d,%d] FROZEN (%d actors, %d enemies)"),
+		CubeCoordinate.X, CubeCoordinate.Y, ManagedActors.Num(), ManagedEnemies.Num());
 }
 
 void ACC_Cube::Unfreeze()
@@ -489,6 +543,21 @@ void ACC_Cube::Unfreeze()
 	SetActorHiddenInGame(false);
 	SetActorTickEnabled(true);
 
+	UCC_EnemyPoolSubsystem* EnemyPool = UCC_EnemyPoolSubsystem::Get(this);
+	if (UCC_EnemyRegistry* Registry = UCC_EnemyRegistry::Get(this))
+	{
+		ManagedEnemies.RemoveStale(*Registry);
+
+		for (const FCC_EnemyHandle& Handle : ManagedEnemies)
+		{
+			ACC_EnemyCharacter* Enemy = Registry->Resolve(Handle);
+			if (Enemy && EnemyPool)
+			{
+				EnemyPool->ResumeEnemy(Enemy);
+			}
+		}
+	}
+
 	// Ҽ Actor Unfreeze
 	for (AActor* Actor : ManagedActors)
 	{
@@ -530,8 +599,8 @@ void ACC_Cube::Unfreeze()
 		}
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("[Cube %d,%d] UNFROZEN (%d actors)"),
-		CubeCoordinate.X, CubeCoordinate.Y, ManagedActors.Num());
+	UE_LOG(LogTemp, Warning, TEXT("[Cube %d,%d] UNFROZEN (%d actors, %d enemies)"),
+		CubeCoordinate.X, CubeCoordinate.Y, ManagedActors.Num(), ManagedEnemies.Num());
 }
 
 void ACC_Cube::OnBoundaryOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
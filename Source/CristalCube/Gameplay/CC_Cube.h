@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "../CristalCubeStruct.h"
+#include "../CC_EnemyRegistry.h"
 #include "CC_Cube.generated.h"
 
 UCLASS()
@@ -153,6 +154,9 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Cube")
 	TArray<AActor*> ManagedActors;
 
+	/**  ť꿡 Ҽӵ  (UCC_EnemyRegistry ڵ, ManagedActors  ) */
+	FCC_EnemyHandleSet ManagedEnemies;
+
 	/** ť ٴ (ð) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Components")
 	UStaticMeshComponent* FloorMesh;
@@ -5,6 +5,7 @@
 #include "Components/SphereComponent.h"
 #include "../Characters/CC_PlayerCharacter.h"
 #include "Kismet/GameplayStatics.h"
+#include "../CC_ExperienceGemPoolSubsystem.h"
 
 // Sets default values
 ACC_ExperienceGem::ACC_ExperienceGem()
@@ -37,6 +38,10 @@ ACC_ExperienceGem::ACC_ExperienceGem()
 	bIsBeingAttracted = false;
 }
 
+// Seconds after activation for the auto-collect and merge checks
+static constexpr float GemInitialCheckDelay = 0.1f;
+static constexpr float GemMergeDelay = 0.5f;
+
 // Called when the game starts or when spawned
 void ACC_ExperienceGem::BeginPlay()
 {
@@ -51,59 +56,23 @@ void ACC_ExperienceGem::BeginPlay()
 		UE_LOG(LogTemp, Warning, TEXT("[ExpGem] No player found!"));
 	}	
 
-	FTimerHandle InitialCheckTimer;
-	GetWorld()->GetTimerManager().SetTimer(
-		InitialCheckTimer,
-		[this]() {
-			if (!IsValid(this) || !TargetPlayer) return;
-
-			float Distance = FVector::Dist(GetActorLocation(), TargetPlayer->GetActorLocation());
-
-			if (Distance <= CollisionSphere->GetScaledSphereRadius())
-			{
-				if (ACC_PlayerCharacter* Player = Cast<ACC_PlayerCharacter>(TargetPlayer))
-				{
-					UE_LOG(LogTemp, Log, TEXT("[ExpGem] Auto-collected (was overlapping)"));
-					Player->AddExperience(ExpAmount);
-					Destroy();
-					return;
-				}
-			}
-		},
-		0.1f,
-		false
-	);
-
-	GetWorld()->GetTimerManager().SetTimer(
-		DistanceCheckTimer,
-		this,
-		&ACC_ExperienceGem::CheckDistanceToPlayer,
-		0.1f,
-		true
-	);
-
-	FTimerHandle MergeTimer;
-	GetWorld()->GetTimerManager().SetTimer(
-		MergeTimer,
-		this,
-		&ACC_ExperienceGem::TryMergeNearbyGems,
-		0.5f,
-		false
-	);
-
-	GetWorld()->GetTimerManager().SetTimer(
-		LifetimeTimer,
-		[this]() {
-			if (IsValid(this))
-			{
-				UE_LOG(LogTemp, Log, TEXT("[ExpGem] Expired"));
-				Destroy();
-			}
-		},
-		Lifetime,
-		false
-	);
+	DefaultMeshScale = GemMesh->GetRelativeScale3D();
+
+	// Gems not spawned through the pool still get the batched update
+	if (UCC_ExperienceGemPoolSubsystem* Pool = UCC_ExperienceGemPoolSubsystem::Get(this))
+	{
+		Pool->TrackGem(this);
+	}
+}
+
+void ACC_ExperienceGem::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UCC_ExperienceGemPoolSubsystem* Pool = UCC_ExperienceGemPoolSubsystem::Get(this))
+	{
+		Pool->UntrackGem(this);
+	}
 
+	Super::EndPlay(EndPlayReason);
 }
 
 // Called every frame
@@ -130,8 +99,6 @@ void ACC_ExperienceGem::CheckDistanceToPlayer()
 	if (Distance <= MagnetRadius)
 	{
 		bIsBeingAttracted = true;
-
-		GetWorld()->GetTimerManager().ClearTimer(DistanceCheckTimer);
 		SetActorTickEnabled(true);
 	}
 
@@ -156,17 +123,14 @@ void ACC_ExperienceGem::MoveTowardsPlayer(float DeltaTime)
 	SetActorLocation(NewLocation);
 }
 
-void ACC_ExperienceGem::TryMergeNearbyGems()
+void ACC_ExperienceGem::TryMergeNearbyGems(const TArray<ACC_ExperienceGem*>& ActiveGems, TArray<ACC_ExperienceGem*>& OutRelease)
 {
-	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ACC_ExperienceGem::StaticClass(), FoundActors);
-
-	for (AActor* Actor : FoundActors)
+	// Active gems only - parked ones sit in the pool with a stale location
+	for (ACC_ExperienceGem* OtherGem : ActiveGems)
 	{
-		if (Actor == this) continue;
+		if (OtherGem == this) continue;
 
-		ACC_ExperienceGem* OtherGem = Cast<ACC_ExperienceGem>(Actor);
-		if (!OtherGem) continue;
+		if (!IsValid(OtherGem) || OtherGem->bPendingRelease) continue;
 
 		float Distance = FVector::Dist(GetActorLocation(), OtherGem->GetActorLocation());
 
@@ -177,7 +141,8 @@ void ACC_ExperienceGem::TryMergeNearbyGems()
 			float Scale = FMath::Clamp(ExpAmount / 10.0f, 0.3f, 0.6f);
 			GemMesh->SetWorldScale3D(FVector(Scale));
 
-			OtherGem->Destroy();
+			OtherGem->bPendingRelease = true;
+			OutRelease.Add(OtherGem);
 
 			UE_LOG(LogTemp, Log, TEXT("[ExpGem] Merged! New value: %f EXP"), ExpAmount);
 		}
@@ -188,6 +153,12 @@ void ACC_ExperienceGem::OnOverlapBegin(UPrimitiveComponent* OverlappedComponent,
 	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep,
 	const FHitResult& SweepResult)
 {
+	// Merged away this batch, or already parked
+	if (bPooled || bPendingRelease)
+	{
+		return;
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("[ExpGem] OverlapBegin is Called"));
 
 	if (ACC_PlayerCharacter* Player = Cast<ACC_PlayerCharacter>(OtherActor))
@@ -196,10 +167,121 @@ void ACC_ExperienceGem::OnOverlapBegin(UPrimitiveComponent* OverlappedComponent,
 
 		UE_LOG(LogTemp, Log, TEXT("[ExpGem] Player collected %f EXP"), ExpAmount);
 
+		ReturnToPool();
+	}
+}
+
+bool ACC_ExperienceGem::TryAutoCollect()
+{
+	if (!TargetPlayer)
+	{
+		return false;
+	}
+
+	float Distance = FVector::Dist(GetActorLocation(), TargetPlayer->GetActorLocation());
+
+	if (Distance <= CollisionSphere->GetScaledSphereRadius())
+	{
+		if (ACC_PlayerCharacter* Player = Cast<ACC_PlayerCharacter>(TargetPlayer))
+		{
+			UE_LOG(LogTemp, Log, TEXT("[ExpGem] Auto-collected (was overlapping)"));
+			Player->AddExperience(ExpAmount);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void ACC_ExperienceGem::UpdateFromPool(float Elapsed, const TArray<ACC_ExperienceGem*>& ActiveGems, TArray<ACC_ExperienceGem*>& OutRelease)
+{
+	if (bPooled || bPendingRelease)
+	{
+		return;
+	}
+
+	const float PreviousTime = ActiveTime;
+	ActiveTime += Elapsed;
+
+	if (ActiveTime >= Lifetime)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[ExpGem] Expired"));
+		bPendingRelease = true;
+		OutRelease.Add(this);
+		return;
+	}
+
+	if (PreviousTime < GemInitialCheckDelay && ActiveTime >= GemInitialCheckDelay && TryAutoCollect())
+	{
+		bPendingRelease = true;
+		OutRelease.Add(this);
+		return;
+	}
+
+	if (!bIsBeingAttracted)
+	{
+		CheckDistanceToPlayer();
+	}
+
+	if (!bMergeChecked && ActiveTime >= GemMergeDelay)
+	{
+		bMergeChecked = true;
+		TryMergeNearbyGems(ActiveGems, OutRelease);
+	}
+}
+
+void ACC_ExperienceGem::ReturnToPool()
+{
+	if (bPooled)
+	{
+		return;
+	}
+
+	if (UCC_ExperienceGemPoolSubsystem* Pool = UCC_ExperienceGemPoolSubsystem::Get(this))
+	{
+		Pool->ReleaseGem(this);
+	}
+	else
+	{
 		Destroy();
 	}
 }
 
+void ACC_ExperienceGem::ActivateGem(const FVector& Location, float Amount)
+{
+	bPooled = false;
+	bPendingRelease = false;
+	bIsBeingAttracted = false;
+	bMergeChecked = false;
+	ActiveTime = 0.0f;
+	ExpAmount = Amount;
+
+	// Player may have respawned since the gem was parked
+	if (!IsValid(TargetPlayer))
+	{
+		TargetPlayer = UGameplayStatics::GetPlayerCharacter(GetWorld(), 0);
+	}
+
+	GemMesh->SetRelativeScale3D(DefaultMeshScale);
+
+	SetActorLocation(Location, false, nullptr, ETeleportType::ResetPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+
+	// Ticks only while attracted
+	SetActorTickEnabled(false);
+}
+
+void ACC_ExperienceGem::DeactivateGem()
+{
+	bPooled = true;
+	bIsBeingAttracted = false;
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+}
+
 void ACC_ExperienceGem::SetExpAmount(float NewAmount)
 {
 	ExpAmount = NewAmount;
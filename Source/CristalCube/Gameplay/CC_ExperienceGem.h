@@ -19,6 +19,8 @@ protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:	
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
@@ -32,12 +34,6 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	UStaticMeshComponent* GemMesh;
 
-	UPROPERTY()
-	FTimerHandle DistanceCheckTimer;
-
-	UPROPERTY()
-	FTimerHandle LifetimeTimer;
-
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	float MergeRadius = 100.0f;
 
@@ -62,11 +58,32 @@ protected:
 	UPROPERTY()
 	class ACharacter* TargetPlayer = nullptr;
 
+	// Seconds since activation, advanced by the pool's batched update (replaces the per-gem timers)
+	float ActiveTime = 0.0f;
+
+	bool bMergeChecked = false;
+
+	// Collected, merged or expired during the current batch - released when it ends
+	bool bPendingRelease = false;
+
+	// Parked in UCC_ExperienceGemPoolSubsystem
+	bool bPooled = false;
+
+	// Index in UCC_ExperienceGemPoolSubsystem::ActiveGems
+	int32 ActiveIndex = INDEX_NONE;
+
+	// Mesh scale before merges grew it
+	FVector DefaultMeshScale = FVector::OneVector;
+
 	void CheckDistanceToPlayer();
 
 	void MoveTowardsPlayer(float DeltaTime);
 
-	void TryMergeNearbyGems();
+	void TryMergeNearbyGems(const TArray<ACC_ExperienceGem*>& ActiveGems, TArray<ACC_ExperienceGem*>& OutRelease);
+
+	// Fallback collect once GemInitialCheckDelay has passed, by distance
+	// (activation normally collects a gem dropped inside the player's reach through OnOverlapBegin already)
+	bool TryAutoCollect();
 
 	UFUNCTION()
 	void OnOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
@@ -77,4 +94,31 @@ public:
 
 	UFUNCTION(BlueprintCallable)
 	void SetExpAmount(float NewAmount);
+
+	float GetExpAmount() const { return ExpAmount; }
+
+	//==========================================================================
+	// POOLING (UCC_ExperienceGemPoolSubsystem)
+	//==========================================================================
+
+	/**
+	 * One step of the pool's batched update
+	 * Expiry, auto-collect, magnet check and merge; gems to release go to OutRelease instead of
+	 * being released here, so ActiveGems is not modified while the pool walks it.
+	 */
+	void UpdateFromPool(float Elapsed, const TArray<ACC_ExperienceGem*>& ActiveGems, TArray<ACC_ExperienceGem*>& OutRelease);
+
+	// Release to the pool (destroy when there is none)
+	UFUNCTION(BlueprintCallable)
+	void ReturnToPool();
+
+	// Fresh drop at Location worth Amount - state as after BeginPlay
+	void ActivateGem(const FVector& Location, float Amount);
+
+	// Hidden, no collision, no tick
+	void DeactivateGem();
+
+	bool IsPooled() const { return bPooled; }
+
+	int32& GetPoolActiveIndex() { return ActiveIndex; }
 };
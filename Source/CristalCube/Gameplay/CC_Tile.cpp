@@ -4,6 +4,7 @@
 #include "CC_Tile.h"
 #include "Components/BoxComponent.h"
 #include "../Characters/CC_EnemyCharacter.h"
+#include "../CC_EnemyRegistry.h"
 
 // Sets default values
 ACC_Tile::ACC_Tile()
@@ -133,9 +134,12 @@ void ACC_Tile::RegisterActor(AActor* Actor)
 
 	ActorsInTile.Add(Actor);
 
-	if (ACC_EnemyCharacter* Enemy = Cast<ACC_EnemyCharacter>(Actor))
+	if (const ACC_EnemyCharacter* Enemy = Cast<ACC_EnemyCharacter>(Actor))
 	{
-		EnemiesInTile.Add(Enemy);
+		if (Enemy->GetEnemyHandle().IsSet())
+		{
+			EnemiesInTile.Add(Enemy->GetEnemyHandle());
+		}
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("Tile %d: %s registered (Total: %d, Enemies: %d)"),
@@ -148,23 +152,48 @@ void ACC_Tile::UnregisterActor(AActor* Actor)
 
 	ActorsInTile.Remove(Actor);
 
-	if (ACC_EnemyCharacter* Enemy = Cast<ACC_EnemyCharacter>(Actor))
+	if (const ACC_EnemyCharacter* Enemy = Cast<ACC_EnemyCharacter>(Actor))
 	{
-		EnemiesInTile.Remove(Enemy);
+		EnemiesInTile.Remove(Enemy->GetEnemyHandle());
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("Tile %d: %s unregistered (Total: %d, Enemies: %d)"),
 		TileIndex, *Actor->GetName(), ActorsInTile.Num(), EnemiesInTile.Num());
 }
 
+TArray<ACC_EnemyCharacter*> ACC_Tile::GetEnemiesInTile() const
+{
+	TArray<ACC_EnemyCharacter*> Enemies;
+
+	const UCC_EnemyRegistry* Registry = UCC_EnemyRegistry::Get(this);
+	if (!Registry) return Enemies;
+
+	Enemies.Reserve(EnemiesInTile.Num());
+	for (const FCC_EnemyHandle& Handle : EnemiesInTile)
+	{
+		if (ACC_EnemyCharacter* Enemy = Registry->Resolve(Handle))
+		{
+			Enemies.Add(Enemy);
+		}
+	}
+
+	return Enemies;
+}
+
 void ACC_Tile::SetEnemiesActive(bool bActive)
 {
-	for (ACC_EnemyCharacter* Enemy : EnemiesInTile)
+	if (UCC_EnemyRegistry* Registry = UCC_EnemyRegistry::Get(this))
 	{
-		if (Enemy)
+		// Ǯ ư  ڵ 
+		EnemiesInTile.RemoveStale(*Registry);
+
+		for (const FCC_EnemyHandle& Handle : EnemiesInTile)
 		{
-			Enemy->SetActorTickEnabled(bActive);
-			Enemy->SetActorHiddenInGame(!bActive);
+			if (ACC_EnemyCharacter* Enemy = Registry->Resolve(Handle))
+			{
+				Enemy->SetActorTickEnabled(bActive);
+				Enemy->SetActorHiddenInGame(!bActive);
+			}
 		}
 	}
 
@@ -4,8 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "../CC_EnemyRegistry.h"
 #include "CC_Tile.generated.h"
 
+class ACC_EnemyCharacter;
+
 UCLASS()
 class CRISTALCUBE_API ACC_Tile : public AActor
 {
@@ -37,8 +40,8 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tile")
 	TArray<AActor*> ActorsInTile;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tile")
-	TArray<class ACC_EnemyCharacter*> EnemiesInTile;
+	/** Ÿ   (UCC_EnemyRegistry ڵ) */
+	FCC_EnemyHandleSet EnemiesInTile;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Components")
 	UStaticMeshComponent* FloorMesh;
@@ -98,7 +101,7 @@ public:
 
 	/** 鸸 */
 	UFUNCTION(BlueprintCallable, Category = "Tile")
-	TArray<ACC_EnemyCharacter*> GetEnemiesInTile() const { return EnemiesInTile; }
+	TArray<ACC_EnemyCharacter*> GetEnemiesInTile() const;
 
 	/**  Ȱȭ/Ȱȭ */
 	UFUNCTION(BlueprintCallable, Category = "Tile")
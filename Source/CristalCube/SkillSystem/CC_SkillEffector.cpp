@@ -8,6 +8,8 @@
 #include "NiagaraComponent.h"
 #include "NiagaraFunctionLibrary.h"
 #include "GameFramework/ProjectileMovementComponent.h"
+#include "../CC_SkillEffectorPoolSubsystem.h"
+#include "TimerManager.h"
 
 // Sets default values
 ACC_SkillEffector::ACC_SkillEffector()
@@ -21,6 +23,7 @@ ACC_SkillEffector::ACC_SkillEffector()
 	CollisionSphere->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
 	CollisionSphere->SetCollisionResponseToAllChannels(ECR_Ignore);
 	CollisionSphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Block);
+	CollisionSphere->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Block);
 	CollisionSphere->SetNotifyRigidBodyCollision(true);
 	CollisionSphere->SetGenerateOverlapEvents(true);
 
@@ -47,10 +50,7 @@ void ACC_SkillEffector::BeginPlay()
 		CollisionSphere->OnComponentBeginOverlap.AddDynamic(this, &ACC_SkillEffector::OnOverlapBegin);
 	}
 
-	if (EffectDuration > 0.0f)
-	{
-		SetLifeSpan(EffectDuration);
-	}
+	StartLifetime();
 
 	CC_LOG_SKILL(Log, "Spawned - CoreType: %d", (int32)SkillCoreType);
 }
@@ -70,6 +70,19 @@ UNiagaraComponent* ACC_SkillEffector::AddVFX(UNiagaraSystem* VFXTemplate)
 		return nullptr;
 	}
 
+	// Pooled effector asked for the same layer again - already reset by ActivateFromPool
+	for (UNiagaraComponent* VFX : VFXStack)
+	{
+		if (VFX && VFX->GetAsset() == VFXTemplate)
+		{
+			if (!VFX->IsActive())
+			{
+				VFX->ResetSystem();
+			}
+			return VFX;
+		}
+	}
+
 	UNiagaraComponent* VFXComponent = UNiagaraFunctionLibrary::SpawnSystemAttached(
 		VFXTemplate,
 		VFXRoot,
@@ -77,7 +90,7 @@ UNiagaraComponent* ACC_SkillEffector::AddVFX(UNiagaraSystem* VFXTemplate)
 		FVector::ZeroVector,
 		FRotator::ZeroRotator,
 		EAttachLocation::KeepRelativeOffset,
-		true  // Auto Destroy
+		false  // Kept for reuse (pooling)
 	);
 
 	if (VFXComponent)
@@ -85,6 +98,11 @@ UNiagaraComponent* ACC_SkillEffector::AddVFX(UNiagaraSystem* VFXTemplate)
 		VFXStack.Add(VFXComponent);
 		CC_LOG_SKILL(Log, "[SkillEffector] Added VFX: %s", *VFXTemplate->GetName());
 
+		if (bHasVFXColor)
+		{
+			VFXComponent->SetVariableLinearColor(FName("User.PrimaryColor"), VFXPrimaryColor);
+			VFXComponent->SetVariableLinearColor(FName("User.SecondaryColor"), VFXSecondaryColor);
+		}
 	}
 
 	return VFXComponent;
@@ -92,6 +110,10 @@ UNiagaraComponent* ACC_SkillEffector::AddVFX(UNiagaraSystem* VFXTemplate)
 
 void ACC_SkillEffector::SetVFXColor(FLinearColor PrimaryColor, FLinearColor SecondaryColor)
 {
+	VFXPrimaryColor = PrimaryColor;
+	VFXSecondaryColor = SecondaryColor;
+	bHasVFXColor = true;
+
 	for (UNiagaraComponent* VFX : VFXStack)
 	{
 		if (VFX)
@@ -121,7 +143,7 @@ void ACC_SkillEffector::Initialize(ESkillCoreType InCoreType, const FSkillDefini
 
 void ACC_SkillEffector::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
-	if (!OtherActor || OtherActor == this || OtherActor == SkillOwner)
+	if (bPooled || !OtherActor || OtherActor == this || OtherActor == SkillOwner)
 	{
 		return;
 	}
@@ -191,6 +213,85 @@ void ACC_SkillEffector::SetupAsProjectile()
 	ProjectileMovement->InitialSpeed = 1000.0f;
 	ProjectileMovement->MaxSpeed = 1000.0f;
 
+	// InitialSpeed is only read when the component initializes - a reused effector needs its launch velocity here
+	ProjectileMovement->Velocity = GetActorForwardVector() * ProjectileMovement->InitialSpeed;
+
 	CC_LOG_SKILL(Log, "[SkillEffector] Setup as Projectile");
 }
 
+void ACC_SkillEffector::StartLifetime()
+{
+	if (EffectDuration > 0.0f)
+	{
+		GetWorldTimerManager().SetTimer(LifetimeTimer, this, &ACC_SkillEffector::ReturnToPool, EffectDuration, false);
+	}
+}
+
+void ACC_SkillEffector::ReturnToPool()
+{
+	if (bPooled)
+	{
+		return;
+	}
+
+	if (UCC_SkillEffectorPoolSubsystem* Pool = UCC_SkillEffectorPoolSubsystem::Get(this))
+	{
+		Pool->ReleaseEffector(this);
+	}
+	else
+	{
+		Destroy();
+	}
+}
+
+void ACC_SkillEffector::DeactivateToPool()
+{
+	bPooled = true;
+
+	GetWorldTimerManager().ClearTimer(LifetimeTimer);
+
+	// Particles gone now, components stay for the next activation
+	for (UNiagaraComponent* VFX : VFXStack)
+	{
+		if (VFX)
+		{
+			VFX->DeactivateImmediate();
+		}
+	}
+
+	if (ProjectileMovement)
+	{
+		ProjectileMovement->StopMovementImmediately();
+		ProjectileMovement->SetActive(false);
+	}
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+
+	SkillOwner = nullptr;
+	SetOwner(nullptr);
+	SetInstigator(nullptr);
+}
+
+void ACC_SkillEffector::ActivateFromPool(const FVector& Location, const FRotator& Rotation)
+{
+	bPooled = false;
+
+	SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+
+	VFXStack.RemoveAll([](const UNiagaraComponent* VFX) { return !IsValid(VFX); });
+	for (UNiagaraComponent* VFX : VFXStack)
+	{
+		VFX->ResetSystem();
+	}
+
+	if (bHasVFXColor)
+	{
+		SetVFXColor(VFXPrimaryColor, VFXSecondaryColor);
+	}
+
+	StartLifetime();
+}
+
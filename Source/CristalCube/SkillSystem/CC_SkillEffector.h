@@ -36,9 +36,11 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	class UProjectileMovementComponent* ProjectileMovement;
 
+	// Kept for the effector's whole life, pooling included - reset on reuse, never destroyed
 	UPROPERTY()
 	TArray<class UNiagaraComponent*> VFXStack;
 
+	// Reuses the stack's component for VFXTemplate when there is one
 	UFUNCTION(BlueprintCallable, Category = "VFX")
 	UNiagaraComponent* AddVFX(UNiagaraSystem* VFXTemplate);
 
@@ -62,6 +64,17 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Skill Effector")
 	FSkillDefinition SkillDef;
 
+	// Last SetVFXColor, applied again when the stack is reset
+	FLinearColor VFXPrimaryColor = FLinearColor::White;
+	FLinearColor VFXSecondaryColor = FLinearColor::White;
+	bool bHasVFXColor = false;
+
+	// EffectDuration, then back to the pool
+	FTimerHandle LifetimeTimer;
+
+	// Parked in UCC_SkillEffectorPoolSubsystem
+	bool bPooled = false;
+
 public:
 
 	UFUNCTION(BlueprintCallable, Category = "Skill Effector")
@@ -77,4 +90,25 @@ public:
 	void ApplyDamageToActor(AActor* TargetActor);
 
 	void SetupAsProjectile();
+
+	FName GetSkillID() const { return SkillDef.SkillID; }
+
+	//==========================================================================
+	// POOLING (UCC_SkillEffectorPoolSubsystem)
+	//==========================================================================
+
+	// Release to the pool (destroy when there is none)
+	UFUNCTION()
+	void ReturnToPool();
+
+	// Stop, hide and silence the VFX stack; components stay attached
+	void DeactivateToPool();
+
+	// Back at the transform with the VFX stack restarted
+	void ActivateFromPool(const FVector& Location, const FRotator& Rotation);
+
+	bool IsPooled() const { return bPooled; }
+
+protected:
+	void StartLifetime();
 };
@@ -4,8 +4,10 @@
 #include "CC_SkillSystem.h"
 #include "../CC_LogHelper.h"
 #include "CC_SkillEffector.h"
+#include "../CC_SkillEffectorPoolSubsystem.h"
 #include "../WeaponSystems/CC_Projectile.h"
 #include "../Characters/CC_Character.h"
+#include "../CC_EnemyManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/DamageEvents.h"
 #include "NiagaraFunctionLibrary.h"
@@ -134,6 +136,12 @@ void UCC_SkillSystem::ExecuteProjectile(const FSkillDefinition& Skill, FSkillExe
 		return;
 	}
 
+	UCC_SkillEffectorPoolSubsystem* EffectorPool = UCC_SkillEffectorPoolSubsystem::Get(this);
+	if (!EffectorPool)
+	{
+		return;
+	}
+
 	int32 ProjectileCount = GetProjectileCount(Skill);
 
 	for (int32 i = 0; i < ProjectileCount; ++i)
@@ -154,13 +162,13 @@ void UCC_SkillSystem::ExecuteProjectile(const FSkillDefinition& Skill, FSkillExe
 		}
 
 		// 2-3. ü 
-		FTransform SpawnTransform;
-		SpawnTransform.SetLocation(SpawnLocation);
-		SpawnTransform.SetRotation(SpawnDirection.ToOrientationQuat());
-
-		ACC_SkillEffector* SkillEffectorProjectile = World->SpawnActor<ACC_SkillEffector>(
+		// Pooled per skill - keeps its Niagara stack between shots
+		ACC_SkillEffector* SkillEffectorProjectile = EffectorPool->AcquireEffector(
 			SkillEffectorClass,
-			SpawnTransform
+			Skill.SkillID,
+			SpawnLocation,
+			SpawnDirection.Rotation(),
+			Context.Caster
 		);
 
 		if (SkillEffectorProjectile)
@@ -376,51 +384,42 @@ int32 UCC_SkillSystem::GetProjectileCount(const FSkillDefinition& Skill) const
 
 AActor* UCC_SkillSystem::FindNearestEnemy(FVector Origin, float Radius, const TArray<AActor*>& ExcludeActors) const
 {
-	TArray<AActor*> FoundEnemies;
-	UGameplayStatics::GetAllActorsWithTag(GetWorld(), EnemyTag, FoundEnemies);
-
-	AActor* NearestEnemy = nullptr;
-	float NearestDistance = Radius;
-
-	for (AActor* Enemy : FoundEnemies)
+	ACC_EnemyManager* EnemyManager = ACC_EnemyManager::Get(this);
+	if (!EnemyManager)
 	{
-		if (!Enemy || ExcludeActors.Contains(Enemy))
-		{
-			continue;
-		}
-
-		float Distance = FVector::Dist(Origin, Enemy->GetActorLocation());
-		if (Distance < NearestDistance)
-		{
-			NearestDistance = Distance;
-			NearestEnemy = Enemy;
-		}
+		return nullptr;
 	}
 
-	return NearestEnemy;
+	//  Ŵ ׸  (ü  ˻ X,    X)
+	EnemyManager->GetNearestEnemies(Origin, Radius, 1, EnemyQueryBuffer, ExcludeActors);
+
+	return EnemyQueryBuffer.Num() > 0 && EnemyQueryBuffer[0]->ActorHasTag(EnemyTag) ? EnemyQueryBuffer[0] : nullptr;
 }
 
 TArray<AActor*> UCC_SkillSystem::FindEnemiesInRadius(FVector Origin, float Radius) const
 {
-	TArray<AActor*> FoundEnemies;
-	UGameplayStatics::GetAllActorsWithTag(GetWorld(), EnemyTag, FoundEnemies);
-
 	TArray<AActor*> EnemiesInRadius;
-	for (AActor* Enemy : FoundEnemies)
-	{
-		if (!Enemy)
-		{
-			continue;
-		}
+	FindEnemiesInRadius(Origin, Radius, EnemiesInRadius);
+	return EnemiesInRadius;
+}
 
-		float Distance = FVector::Dist(Origin, Enemy->GetActorLocation());
-		if (Distance <= Radius)
-		{
-			EnemiesInRadius.Add(Enemy);
-		}
+int32 UCC_SkillSystem::FindEnemiesInRadius(FVector Origin, float Radius, TArray<AActor*>& OutEnemies) const
+{
+	OutEnemies.Reset();
+
+	ACC_EnemyManager* EnemyManager = ACC_EnemyManager::Get(this);
+	if (!EnemyManager)
+	{
+		return 0;
 	}
 
-	return EnemiesInRadius;
+	EnemyManager->GetEnemiesInRadius(Origin, Radius, OutEnemies);
+
+	OutEnemies.RemoveAll([this](AActor* Enemy) {
+		return !Enemy->ActorHasTag(EnemyTag);
+		});
+
+	return OutEnemies.Num();
 }
 
 void UCC_SkillSystem::ApplyDamage(AActor* Target, float Damage, AActor* DamageCauser)
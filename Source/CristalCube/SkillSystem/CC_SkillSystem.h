@@ -145,6 +145,11 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Skill System|Utility")
 	TArray<AActor*> FindEnemiesInRadius(FVector Origin, float Radius) const;
 
+	/**
+	 * ݰ    ã (ȣ  , ݸ Ҵ X)
+	 */
+	int32 FindEnemiesInRadius(FVector Origin, float Radius, TArray<AActor*>& OutEnemies) const;
+
 	/**
 	 *  
 	 */
@@ -189,4 +194,7 @@ protected:
 	//    ų (Phase 2+ Ȯ)
 	UPROPERTY()
 	TArray<FSkillExecutionContext> ActiveSkills;
+
+	//  ˻   ()
+	mutable TArray<AActor*> EnemyQueryBuffer;
 };
@@ -0,0 +1,574 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CC_SpatialQueryTester.h"
+#include "../CC_EnemySpatialHash.h"
+#include "../CC_EnemyManager.h"
+#include "../CC_FlowField.h"
+#include "TimerManager.h"
+
+namespace
+{
+	// Odd sizes on purpose - exercises the scalar tail of the vector kernel
+	const int32 TestSnapshotSizes[] = { 0, 1, 3, 4, 7, 64, 257, 1001 };
+
+	// Enemies are scattered over a few cubes around the origin
+	const float TestWorldExtent = 3000.0f;
+}
+
+// Sets default values
+ACC_SpatialQueryTester::ACC_SpatialQueryTester()
+{
+	PrimaryActorTick.bCanEverTick = false;
+}
+
+// Called when the game starts or when spawned
+void ACC_SpatialQueryTester::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (bAutoRunTests)
+	{
+		GetWorld()->GetTimerManager().SetTimer(
+			TestTimerHandle,
+			this,
+			&ACC_SpatialQueryTester::RunAllTests,
+			TestStartDelay,
+			false
+		);
+	}
+}
+
+void ACC_SpatialQueryTester::RunAllTests()
+{
+	UE_LOG(LogTemp, Warning, TEXT("=============================================="));
+	UE_LOG(LogTemp, Warning, TEXT("   SPATIAL QUERY - AUTOMATED TESTING"));
+	UE_LOG(LogTemp, Warning, TEXT("=============================================="));
+
+	TestResults.Empty();
+
+	Test_SphereKernels();
+	Test_ConeKernels();
+	Test_BoxKernels();
+	Test_ConeMatchesAngleMath();
+	Test_SpatialHashMatchesFullScan();
+	Test_KNearestMatchesSort();
+	Test_WrapMatchesMinimumImage();
+	Test_FlowFieldReachesGoal();
+
+	PrintTestReport();
+}
+
+void ACC_SpatialQueryTester::PrintTestReport()
+{
+	int32 PassedTests = 0;
+	int32 TotalTests = TestResults.Num();
+
+	for (const FTestResult& Result : TestResults)
+	{
+		if (Result.bPassed)
+			PassedTests++;
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("=============================================="));
+	UE_LOG(LogTemp, Warning, TEXT("   SPATIAL QUERY TEST REPORT"));
+	UE_LOG(LogTemp, Warning, TEXT("=============================================="));
+	UE_LOG(LogTemp, Warning, TEXT("Total Tests: %d"), TotalTests);
+	UE_LOG(LogTemp, Warning, TEXT("Passed: %d"), PassedTests);
+	UE_LOG(LogTemp, Warning, TEXT("Failed: %d"), TotalTests - PassedTests);
+	UE_LOG(LogTemp, Warning, TEXT("=============================================="));
+
+	for (const FTestResult& Result : TestResults)
+	{
+		FString Status = Result.bPassed ? TEXT("[PASS]") : TEXT("[FAIL]");
+		UE_LOG(LogTemp, Warning, TEXT("%s %s: %s"), *Status, *Result.TestName, *Result.Message);
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("=============================================="));
+
+	if (PassedTests == TotalTests)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("   ALL TESTS PASSED!"));
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("   SOME TESTS FAILED!"));
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("=============================================="));
+}
+
+// ========================================
+// Individual Tests
+// ========================================
+
+bool ACC_SpatialQueryTester::Test_SphereKernels()
+{
+	FString Message;
+	bool bPassed = CompareKernels(ECC_EnemyQueryShape::Sphere, Message);
+	AddTestResult(TEXT("Sphere Kernels"), bPassed, Message);
+	return bPassed;
+}
+
+bool ACC_SpatialQueryTester::Test_ConeKernels()
+{
+	FString Message;
+	bool bPassed = CompareKernels(ECC_EnemyQueryShape::Cone, Message);
+	AddTestResult(TEXT("Cone Kernels"), bPassed, Message);
+	return bPassed;
+}
+
+bool ACC_SpatialQueryTester::Test_BoxKernels()
+{
+	FString Message;
+	bool bPassed = CompareKernels(ECC_EnemyQueryShape::Box, Message);
+	AddTestResult(TEXT("Box Kernels"), bPassed, Message);
+	return bPassed;
+}
+
+bool ACC_SpatialQueryTester::Test_ConeMatchesAngleMath()
+{
+	FRandomStream Random(RandomSeed);
+
+	FCC_EnemySnapshot Snapshot;
+	BuildRandomSnapshot(Random, 1001, Snapshot);
+
+	int32 Compared = 0;
+	int32 Mismatches = 0;
+
+	for (int32 QueryIndex = 0; QueryIndex < QueriesPerSize; ++QueryIndex)
+	{
+		const FVector Origin(Random.FRandRange(-TestWorldExtent, TestWorldExtent), Random.FRandRange(-TestWorldExtent, TestWorldExtent), 0.0f);
+		const FVector Direction = Random.GetUnitVector();
+		const float Range = Random.FRandRange(200.0f, 2000.0f);
+		const float HalfAngle = Random.FRandRange(5.0f, 175.0f);
+
+		TArray<int32> Entries;
+		FCC_EnemyQueryKernels::FilterVector(Snapshot, 0, Snapshot.Num(),
+			FCC_EnemyShapeQuery::MakeCone(Origin, Direction, Range, HalfAngle), Entries);
+
+		for (int32 EntryIndex = 0; EntryIndex < Snapshot.Num(); ++EntryIndex)
+		{
+			if (!Snapshot.Alive[EntryIndex])
+			{
+				continue;
+			}
+
+			// Old per-enemy math from UCC_SearchingComponent::GetEnemiesInCone
+			FVector ToEnemy = Snapshot.GetLocation(EntryIndex) - Origin;
+			float Distance = ToEnemy.Size();
+			ToEnemy.Normalize();
+			float AngleInDegrees = FMath::RadiansToDegrees(FMath::Acos(FVector::DotProduct(Direction, ToEnemy)));
+
+			// Skip enemies sitting on the boundary (float rounding may go either way)
+			if (FMath::Abs(AngleInDegrees - HalfAngle) < 0.01f || FMath::Abs(Distance - Range) < 0.1f)
+			{
+				continue;
+			}
+
+			const bool bExpected = Distance <= Range && AngleInDegrees <= HalfAngle;
+			if (bExpected != Entries.Contains(EntryIndex))
+			{
+				Mismatches++;
+			}
+			Compared++;
+		}
+	}
+
+	bool bPassed = Mismatches == 0;
+	AddTestResult(TEXT("Cone Matches Angle Math"), bPassed,
+		FString::Printf(TEXT("Compared: %d, Mismatches: %d"), Compared, Mismatches));
+	return bPassed;
+}
+
+bool ACC_SpatialQueryTester::Test_SpatialHashMatchesFullScan()
+{
+	FRandomStream Random(RandomSeed + 1);
+
+	const int32 NumEnemies = 1001;
+	TArray<FVector> Positions;
+	Positions.SetNumUninitialized(NumEnemies);
+	for (FVector& Position : Positions)
+	{
+		Position = FVector(Random.FRandRange(-TestWorldExtent, TestWorldExtent), Random.FRandRange(-TestWorldExtent, TestWorldExtent), Random.FRandRange(0.0f, 200.0f));
+	}
+
+	FCC_EnemySpatialHash SpatialHash;
+	SpatialHash.SetCellSize(400.0f);
+	SpatialHash.Build(Positions);
+
+	// Same layout ACC_EnemyManager builds: snapshot in hash entry order
+	FCC_EnemySnapshot Snapshot;
+	BuildSnapshotFromLocations(Positions, &SpatialHash, Snapshot);
+
+	int32 Mismatches = 0;
+	const ECC_EnemyQueryShape Shapes[] = { ECC_EnemyQueryShape::Sphere, ECC_EnemyQueryShape::Cone, ECC_EnemyQueryShape::Box };
+
+	for (ECC_EnemyQueryShape Shape : Shapes)
+	{
+		for (int32 QueryIndex = 0; QueryIndex < QueriesPerSize; ++QueryIndex)
+		{
+			const FCC_EnemyShapeQuery Query = MakeRandomQuery(Random, Shape);
+
+			TArray<int32> FullScan;
+			FCC_EnemyQueryKernels::FilterScalar(Snapshot, 0, NumEnemies, Query, FullScan);
+
+			TArray<int32> CellWalk;
+			const float Bound = Query.BoundingRadius;
+			SpatialHash.ForEachRangeInRect(
+				FVector2D(Query.Origin.X - Bound, Query.Origin.Y - Bound),
+				FVector2D(Query.Origin.X + Bound, Query.Origin.Y + Bound),
+				[&](int32 StartEntry, int32 EndEntry)
+				{
+					FCC_EnemyQueryKernels::FilterVector(Snapshot, StartEntry, EndEntry, Query, CellWalk);
+				});
+
+			// Cell order differs from entry order - compare as sets
+			FullScan.Sort();
+			CellWalk.Sort();
+			if (FullScan != CellWalk)
+			{
+				Mismatches++;
+			}
+		}
+	}
+
+	bool bPassed = Mismatches == 0;
+	AddTestResult(TEXT("Spatial Hash Matches Full Scan"), bPassed,
+		FString::Printf(TEXT("Queries: %d, Mismatches: %d"), QueriesPerSize * 3, Mismatches));
+	return bPassed;
+}
+
+bool ACC_SpatialQueryTester::Test_KNearestMatchesSort()
+{
+	FRandomStream Random(RandomSeed + 2);
+
+	const int32 NumEnemies = 1001;
+	TArray<FVector> Positions;
+	Positions.SetNumUninitialized(NumEnemies);
+	for (FVector& Position : Positions)
+	{
+		Position = FVector(Random.FRandRange(-TestWorldExtent, TestWorldExtent), Random.FRandRange(-TestWorldExtent, TestWorldExtent), 0.0f);
+	}
+
+	FCC_EnemySpatialHash SpatialHash;
+	SpatialHash.SetCellSize(400.0f);
+	SpatialHash.Build(Positions);
+
+	FCC_EnemySnapshot Snapshot;
+	BuildSnapshotFromLocations(Positions, &SpatialHash, Snapshot);
+
+	int32 Mismatches = 0;
+
+	for (int32 QueryIndex = 0; QueryIndex < QueriesPerSize; ++QueryIndex)
+	{
+		const FVector Origin(Random.FRandRange(-TestWorldExtent, TestWorldExtent), Random.FRandRange(-TestWorldExtent, TestWorldExtent), 0.0f);
+		const float Radius = Random.FRandRange(100.0f, 4000.0f);
+		const int32 K = Random.RandRange(1, 40);
+
+		// Reference: everything in range, fully sorted
+		TArray<float> Expected;
+		for (int32 EntryIndex = 0; EntryIndex < NumEnemies; ++EntryIndex)
+		{
+			const float DistSq = Snapshot.DistSquared(EntryIndex, Origin);
+			if (DistSq < Radius * Radius)
+			{
+				Expected.Add(DistSq);
+			}
+		}
+		Expected.Sort();
+		Expected.SetNum(FMath::Min(K, Expected.Num()));
+
+		TArray<FCC_NearestEntry, TInlineAllocator<32>> Nearest;
+		SpatialHash.FindKNearest(Snapshot, Origin, Radius, K, [](int32) { return true; }, Nearest);
+
+		// Compare distances (ties may pick different entries)
+		bool bMatch = Nearest.Num() == Expected.Num();
+		for (int32 i = 0; bMatch && i < Nearest.Num(); ++i)
+		{
+			bMatch = Nearest[i].DistSq == Expected[i];
+		}
+
+		if (!bMatch)
+		{
+			Mismatches++;
+		}
+	}
+
+	bool bPassed = Mismatches == 0;
+	AddTestResult(TEXT("K-Nearest Matches Sort"), bPassed,
+		FString::Printf(TEXT("Queries: %d, Mismatches: %d"), QueriesPerSize, Mismatches));
+	return bPassed;
+}
+
+bool ACC_SpatialQueryTester::Test_WrapMatchesMinimumImage()
+{
+	FRandomStream Random(RandomSeed + 3);
+
+	// The whole test area is one wrap period
+	FCC_WorldWrap Wrap;
+	Wrap.Set(FVector::ZeroVector, FVector2D(TestWorldExtent * 2.0f, TestWorldExtent * 2.0f));
+
+	const int32 NumEnemies = 1001;
+	TArray<FVector> Positions;
+	Positions.SetNumUninitialized(NumEnemies);
+	for (FVector& Position : Positions)
+	{
+		Position = FVector(Random.FRandRange(-TestWorldExtent, TestWorldExtent), Random.FRandRange(-TestWorldExtent, TestWorldExtent), 0.0f);
+	}
+
+	FCC_EnemySpatialHash SpatialHash;
+	SpatialHash.SetCellSize(400.0f);
+	SpatialHash.Build(Positions);
+
+	FCC_EnemySnapshot Snapshot;
+	BuildSnapshotFromLocations(Positions, &SpatialHash, Snapshot);
+
+	int32 Mismatches = 0;
+	int32 Duplicates = 0;
+
+	for (int32 QueryIndex = 0; QueryIndex < QueriesPerSize; ++QueryIndex)
+	{
+		// Origins near the seams, radii up to the full period (images overlap)
+		const FVector Origin(
+			Random.FRandRange(TestWorldExtent * 0.7f, TestWorldExtent) * (Random.FRand() < 0.5f ? -1.0f : 1.0f),
+			Random.FRandRange(-TestWorldExtent, TestWorldExtent),
+			0.0f);
+		const float Radius = Random.FRandRange(100.0f, TestWorldExtent * 2.0f);
+
+		TArray<int32> Expected;
+		for (int32 EntryIndex = 0; EntryIndex < NumEnemies; ++EntryIndex)
+		{
+			if (Wrap.DistSquared(Origin, Snapshot.GetLocation(EntryIndex)) <= Radius * Radius)
+			{
+				Expected.Add(EntryIndex);
+			}
+		}
+
+		TArray<int32> Gathered;
+		ACC_EnemyManager::GatherEntriesInShape(SpatialHash, Snapshot, Wrap, FCC_EnemyShapeQuery::MakeSphere(Origin, Radius), Gathered);
+
+		const int32 GatheredNum = Gathered.Num();
+		FCC_EnemyQueryKernels::RemoveDuplicateEntries(Gathered);
+		if (Gathered.Num() != GatheredNum)
+		{
+			Duplicates++;
+		}
+
+		if (Expected != Gathered)
+		{
+			Mismatches++;
+		}
+	}
+
+	bool bPassed = Mismatches == 0 && Duplicates == 0;
+	AddTestResult(TEXT("Wrap Matches Minimum Image"), bPassed,
+		FString::Printf(TEXT("Queries: %d, Mismatches: %d, Duplicates: %d"), QueriesPerSize, Mismatches, Duplicates));
+	return bPassed;
+}
+
+bool ACC_SpatialQueryTester::Test_FlowFieldReachesGoal()
+{
+	const float CellSize = 200.0f;
+	const FVector2D FieldSize(TestWorldExtent * 2.0f, TestWorldExtent * 2.0f);
+
+	FCC_FlowField FlowField;
+	FlowField.Initialize(FVector2D::ZeroVector, FieldSize, CellSize, true);
+
+	const FVector Goal(TestWorldExtent * 0.8f, 0.0f, 0.0f);
+	FlowField.Update(Goal);
+
+	// Open field - every cell has line of sight, enemies steer straight
+	int32 OpenFieldSamples = 0;
+	FVector2D Direction;
+	for (float X = -TestWorldExtent; X < TestWorldExtent; X += CellSize)
+	{
+		for (float Y = -TestWorldExtent; Y < TestWorldExtent; Y += CellSize)
+		{
+			OpenFieldSamples += FlowField.SampleDirection(FVector(X + CellSize * 0.5f, Y + CellSize * 0.5f, 0.0f), Direction) ? 1 : 0;
+		}
+	}
+
+	// Wall through the middle (full height except a gap) - enemies behind it must be routed
+	const FIntPoint GoalCell = FlowField.GetGoalCell();
+	const FIntPoint WallStart = FlowField.GetCell(FVector(0.0f, -TestWorldExtent, 0.0f));
+	const FIntPoint WallEnd = FlowField.GetCell(FVector(0.0f, TestWorldExtent * 0.6f, 0.0f));
+	for (int32 Y = WallStart.Y; Y <= WallEnd.Y; ++Y)
+	{
+		FlowField.SetCellCost(FIntPoint(WallStart.X, Y), FCC_FlowField::BlockedCost);
+	}
+	FlowField.Update(Goal);
+
+	// Follow the field from every free cell (straight steps where it says "line of sight")
+	int32 Walks = 0;
+	int32 FailedWalks = 0;
+	const int32 MaxSteps = FlowField.GetCellCount();
+
+	for (float StartX = -TestWorldExtent; StartX < TestWorldExtent; StartX += CellSize)
+	{
+		for (float StartY = -TestWorldExtent; StartY < TestWorldExtent; StartY += CellSize)
+		{
+			FVector Location(StartX + CellSize * 0.5f, StartY + CellSize * 0.5f, 0.0f);
+			if (FlowField.GetCell(Location).X == WallStart.X && FlowField.GetCell(Location).Y <= WallEnd.Y)
+			{
+				continue;
+			}
+
+			Walks++;
+			bool bReached = false;
+			for (int32 Step = 0; Step < MaxSteps && !bReached; ++Step)
+			{
+				const FIntPoint Cell = FlowField.GetCell(Location);
+				if (Cell == GoalCell)
+				{
+					bReached = true;
+					break;
+				}
+
+				if (!FlowField.SampleDirection(Location, Direction))
+				{
+					// Line of sight - the rest of the way is a straight line
+					bReached = true;
+					break;
+				}
+
+				// One cell along the direction (diagonals land on the diagonal neighbour)
+				Location += FVector(FMath::RoundToFloat(Direction.X * 1.4f), FMath::RoundToFloat(Direction.Y * 1.4f), 0.0f) * CellSize;
+				Location.X = FMath::Wrap(Location.X, -TestWorldExtent, TestWorldExtent);
+				Location.Y = FMath::Wrap(Location.Y, -TestWorldExtent, TestWorldExtent);
+
+				const FIntPoint NextCell = FlowField.GetCell(Location);
+				if (NextCell.X == WallStart.X && NextCell.Y >= WallStart.Y && NextCell.Y <= WallEnd.Y)
+				{
+					break;
+				}
+			}
+
+			FailedWalks += bReached ? 0 : 1;
+		}
+	}
+
+	bool bPassed = OpenFieldSamples == 0 && FailedWalks == 0;
+	AddTestResult(TEXT("Flow Field Reaches Goal"), bPassed,
+		FString::Printf(TEXT("Cells: %d, Open-field samples: %d, Walks: %d, Failed: %d"),
+			FlowField.GetCellCount(), OpenFieldSamples, Walks, FailedWalks));
+	return bPassed;
+}
+
+// ========================================
+// Utilities
+// ========================================
+
+void ACC_SpatialQueryTester::AddTestResult(const FString& TestName, bool bPassed, const FString& Message)
+{
+	FTestResult Result;
+	Result.TestName = TestName;
+	Result.bPassed = bPassed;
+	Result.Message = Message;
+	TestResults.Add(Result);
+}
+
+void ACC_SpatialQueryTester::BuildSnapshotFromLocations(const TArray<FVector>& Locations, const FCC_EnemySpatialHash* SpatialHash, FCC_EnemySnapshot& OutSnapshot)
+{
+	const int32 NumEnemies = Locations.Num();
+	OutSnapshot.SetNum(NumEnemies);
+
+	for (int32 EntryIndex = 0; EntryIndex < NumEnemies; ++EntryIndex)
+	{
+		const FVector& Location = Locations[SpatialHash ? SpatialHash->GetSourceIndex(EntryIndex) : EntryIndex];
+		OutSnapshot.X[EntryIndex] = Location.X;
+		OutSnapshot.Y[EntryIndex] = Location.Y;
+		OutSnapshot.Z[EntryIndex] = Location.Z;
+		OutSnapshot.Radius[EntryIndex] = 50.0f;
+		OutSnapshot.Alive[EntryIndex] = 1;
+		OutSnapshot.Handle[EntryIndex].Index = EntryIndex;
+		OutSnapshot.Handle[EntryIndex].Generation = 1;
+		OutSnapshot.Actors[EntryIndex] = nullptr;
+	}
+}
+
+void ACC_SpatialQueryTester::BuildRandomSnapshot(FRandomStream& Random, int32 NumEnemies, FCC_EnemySnapshot& OutSnapshot) const
+{
+	TArray<FVector> Locations;
+	Locations.SetNumUninitialized(NumEnemies);
+	for (FVector& Location : Locations)
+	{
+		Location = FVector(Random.FRandRange(-TestWorldExtent, TestWorldExtent), Random.FRandRange(-TestWorldExtent, TestWorldExtent), Random.FRandRange(0.0f, 200.0f));
+	}
+
+	BuildSnapshotFromLocations(Locations, nullptr, OutSnapshot);
+
+	// Some dead entries, the kernels must skip them
+	for (int32 EntryIndex = 0; EntryIndex < NumEnemies; ++EntryIndex)
+	{
+		OutSnapshot.Alive[EntryIndex] = Random.FRand() < 0.9f ? 1 : 0;
+	}
+}
+
+FCC_EnemyShapeQuery ACC_SpatialQueryTester::MakeRandomQuery(FRandomStream& Random, ECC_EnemyQueryShape Shape) const
+{
+	const FVector Origin(Random.FRandRange(-TestWorldExtent, TestWorldExtent), Random.FRandRange(-TestWorldExtent, TestWorldExtent), 100.0f);
+
+	switch (Shape)
+	{
+	case ECC_EnemyQueryShape::Cone:
+		return FCC_EnemyShapeQuery::MakeCone(Origin, Random.GetUnitVector(), Random.FRandRange(100.0f, 2500.0f), Random.FRandRange(0.0f, 180.0f));
+
+	case ECC_EnemyQueryShape::Box:
+		return FCC_EnemyShapeQuery::MakeBox(Origin,
+			FVector(Random.FRandRange(50.0f, 1500.0f), Random.FRandRange(50.0f, 1500.0f), Random.FRandRange(50.0f, 500.0f)),
+			FRotator(Random.FRandRange(-30.0f, 30.0f), Random.FRandRange(0.0f, 360.0f), Random.FRandRange(-30.0f, 30.0f)));
+
+	case ECC_EnemyQueryShape::Sphere:
+	default:
+		return FCC_EnemyShapeQuery::MakeSphere(Origin, Random.FRandRange(100.0f, 2500.0f));
+	}
+}
+
+bool ACC_SpatialQueryTester::CompareKernels(ECC_EnemyQueryShape Shape, FString& OutMessage)
+{
+	FRandomStream Random(RandomSeed);
+
+	int32 TotalQueries = 0;
+	int32 TotalHits = 0;
+	int32 Mismatches = 0;
+
+	for (int32 NumEnemies : TestSnapshotSizes)
+	{
+		FCC_EnemySnapshot Snapshot;
+		BuildRandomSnapshot(Random, NumEnemies, Snapshot);
+
+		for (int32 QueryIndex = 0; QueryIndex < QueriesPerSize; ++QueryIndex)
+		{
+			const FCC_EnemyShapeQuery Query = MakeRandomQuery(Random, Shape);
+
+			// Full range, then a random sub-range (cells hand out arbitrary slices)
+			const int32 SubStart = NumEnemies > 0 ? Random.RandRange(0, NumEnemies - 1) : 0;
+			const int32 SubEnd = NumEnemies > 0 ? Random.RandRange(SubStart, NumEnemies) : 0;
+
+			const int32 Ranges[2][2] = { { 0, NumEnemies }, { SubStart, SubEnd } };
+
+			for (const int32* Range : Ranges)
+			{
+				TArray<int32> ScalarEntries;
+				TArray<int32> VectorEntries;
+				FCC_EnemyQueryKernels::FilterScalar(Snapshot, Range[0], Range[1], Query, ScalarEntries);
+				FCC_EnemyQueryKernels::FilterVector(Snapshot, Range[0], Range[1], Query, VectorEntries);
+
+				// Both keep entry order, so results must be identical element by element
+				if (ScalarEntries != VectorEntries)
+				{
+					Mismatches++;
+					UE_LOG(LogTemp, Error, TEXT("[SpatialQueryTester] Mismatch: Shape %d, Range [%d, %d), Scalar %d, Vector %d"),
+						(int32)Shape, Range[0], Range[1], ScalarEntries.Num(), VectorEntries.Num());
+				}
+
+				TotalHits += ScalarEntries.Num();
+				TotalQueries++;
+			}
+		}
+	}
+
+	OutMessage = FString::Printf(TEXT("Queries: %d, Hits: %d, Mismatches: %d"), TotalQueries, TotalHits, Mismatches);
+	return Mismatches == 0;
+}
@@ -0,0 +1,107 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "CC_CubeSystemTester.h"
+#include "../CC_EnemyQueryKernels.h"
+#include "CC_SpatialQueryTester.generated.h"
+
+/**
+ * Verifies the enemy query kernels on synthetic snapshots (no enemies spawned)
+ * Scalar and vector kernels must return exactly the same entries.
+ */
+UCLASS()
+class CRISTALCUBE_API ACC_SpatialQueryTester : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	// Sets default values for this actor's properties
+	ACC_SpatialQueryTester();
+
+protected:
+	// Called when the game starts or when spawned
+	virtual void BeginPlay() override;
+
+public:
+	// ========== Settings ==========
+
+	/** Run tests automatically on BeginPlay */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Testing")
+	bool bAutoRunTests = true;
+
+	/** Delay before the tests start */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Testing")
+	float TestStartDelay = 1.0f;
+
+	/** Random queries per snapshot size */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Testing")
+	int32 QueriesPerSize = 50;
+
+	/** Seed for positions and queries (same seed = same run) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Testing")
+	int32 RandomSeed = 1234;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Testing")
+	TArray<FTestResult> TestResults;
+
+	// ========== Tests ==========
+
+	UFUNCTION(BlueprintCallable, Category = "Testing")
+	void RunAllTests();
+
+	UFUNCTION(BlueprintCallable, Category = "Testing")
+	void PrintTestReport();
+
+	/** Test 1: Sphere scalar == vector */
+	UFUNCTION(BlueprintCallable, Category = "Testing")
+	bool Test_SphereKernels();
+
+	/** Test 2: Cone scalar == vector */
+	UFUNCTION(BlueprintCallable, Category = "Testing")
+	bool Test_ConeKernels();
+
+	/** Test 3: Box scalar == vector */
+	UFUNCTION(BlueprintCallable, Category = "Testing")
+	bool Test_BoxKernels();
+
+	/** Test 4: Cone kernel agrees with the old Acos angle test (away from the boundary) */
+	UFUNCTION(BlueprintCallable, Category = "Testing")
+	bool Test_ConeMatchesAngleMath();
+
+	/** Test 5: Spatial hash cell walk returns the same entries as a full scan */
+	UFUNCTION(BlueprintCallable, Category = "Testing")
+	bool Test_SpatialHashMatchesFullScan();
+
+	/** Test 6: Grid k-nearest (bounded heap) matches a full sort */
+	UFUNCTION(BlueprintCallable, Category = "Testing")
+	bool Test_KNearestMatchesSort();
+
+	/** Test 7: Wrapped radius queries match a minimum-image full scan, no duplicates */
+	UFUNCTION(BlueprintCallable, Category = "Testing")
+	bool Test_WrapMatchesMinimumImage();
+
+	/** Test 8: Flow field walks reach the goal around a wall (across seams), open field steers straight */
+	UFUNCTION(BlueprintCallable, Category = "Testing")
+	bool Test_FlowFieldReachesGoal();
+
+	void AddTestResult(const FString& TestName, bool bPassed, const FString& Message);
+
+protected:
+
+	FTimerHandle TestTimerHandle;
+
+	// Snapshot of Locations, in hash entry order like ACC_EnemyManager builds it (null hash = Locations order)
+	// All alive, Actors left null
+	static void BuildSnapshotFromLocations(const TArray<FVector>& Locations, const class FCC_EnemySpatialHash* SpatialHash, FCC_EnemySnapshot& OutSnapshot);
+
+	// Random snapshot in entry order (Actors left null)
+	void BuildRandomSnapshot(FRandomStream& Random, int32 NumEnemies, FCC_EnemySnapshot& OutSnapshot) const;
+
+	FCC_EnemyShapeQuery MakeRandomQuery(FRandomStream& Random, ECC_EnemyQueryShape Shape) const;
+
+	// Compare scalar/vector over random sub-ranges (odd starts = unaligned loads, short tails)
+	bool CompareKernels(ECC_EnemyQueryShape Shape, FString& OutMessage);
+};
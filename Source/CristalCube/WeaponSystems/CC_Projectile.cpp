@@ -8,6 +8,8 @@
 #include "NiagaraFunctionLibrary.h"
 #include "../SkillSystem/CC_SkillSystem.h"
 #include "../Characters/CC_EnemyCharacter.h"
+#include "../CC_ProjectilePoolSubsystem.h"
+#include "TimerManager.h"
 
 // Sets default values
 ACC_Projectile::ACC_Projectile()
@@ -33,6 +35,7 @@ ACC_Projectile::ACC_Projectile()
 
 	// Enemy ä(ECC_GameTraceChannel1) Overlap
 	CollisionSphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+	CollisionSphere->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Overlap);
 
 	// Overlap ̺Ʈ 
 	CollisionSphere->SetGenerateOverlapEvents(true);
@@ -69,8 +72,8 @@ ACC_Projectile::ACC_Projectile()
 	// Ownership
 	ProjectileOwner = nullptr;
 
-	// Set lifespan
-	InitialLifeSpan = Lifetime;
+	// Lifetime runs on LifetimeTimer so expiry returns to the pool instead of destroying
+	InitialLifeSpan = 0.0f;
 }
 
 // Called when the game starts or when spawned
@@ -95,6 +98,9 @@ void ACC_Projectile::BeginPlay()
 		ProjectileMovement->MaxSpeed = Speed;
 	}
 
+	// Spawned without InitializeProjectile (Blueprint) - still expires
+	GetWorldTimerManager().SetTimer(LifetimeTimer, this, &ACC_Projectile::ReturnToPool, Lifetime, false);
+
 	//if (CollisionSphere)
 	//{
 	//	UE_LOG(LogTemp, Error, TEXT("[PROJECTILE] Collision Enabled: %d"),
@@ -139,25 +145,90 @@ void ACC_Projectile::SetProjectileOwner(AActor* NewOwner)
 	SetInstigator(Cast<APawn>(NewOwner));
 }
 
-void ACC_Projectile::InitializeProjectile(float InDamage, float InSpeed)
+void ACC_Projectile::InitializeProjectile(float InDamage, float InSpeed, AActor* InOwner)
 {
 	Damage = InDamage;
 
-	if (InSpeed > 0.0f)
+	// A pooled projectile still carries its last shot - start over from the class defaults
+	Speed = InSpeed > 0.0f ? InSpeed : GetClass()->GetDefaultObject<ACC_Projectile>()->Speed;
+	CurrentPierceCount = 0;
+	SetProjectileOwner(InOwner);
+
+	if (ProjectileMovement)
 	{
-		Speed = InSpeed;
-		if (ProjectileMovement)
-		{
-			ProjectileMovement->InitialSpeed = Speed;
-			ProjectileMovement->MaxSpeed = Speed;
-		}
+		ProjectileMovement->InitialSpeed = Speed;
+		ProjectileMovement->MaxSpeed = Speed;
+		ProjectileMovement->Velocity = GetActorForwardVector() * Speed;
+	}
+
+	GetWorldTimerManager().SetTimer(LifetimeTimer, this, &ACC_Projectile::ReturnToPool, Lifetime, false);
+
+	// Pooled projectiles come back without collision - overlaps only once this shot's damage and owner are set
+	SetActorEnableCollision(true);
+}
+
+void ACC_Projectile::ReturnToPool()
+{
+	if (bPooled)
+	{
+		return;
+	}
+
+	if (UCC_ProjectilePoolSubsystem* Pool = UCC_ProjectilePoolSubsystem::Get(this))
+	{
+		Pool->ReleaseProjectile(this);
+	}
+	else
+	{
+		Destroy();
+	}
+}
+
+void ACC_Projectile::DeactivateToPool()
+{
+	bPooled = true;
+
+	GetWorldTimerManager().ClearTimer(LifetimeTimer);
+
+	if (ProjectileMovement)
+	{
+		ProjectileMovement->StopMovementImmediately();
+		ProjectileMovement->Deactivate();
+	}
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+
+	// Nothing from the last shot survives into the next one
+	Damage = 0.0f;
+	CurrentPierceCount = 0;
+	SkillSystem = nullptr;
+	ProjectileOwner = nullptr;
+	SetOwner(nullptr);
+	SetInstigator(nullptr);
+}
+
+void ACC_Projectile::ActivateFromPool(const FVector& Location, const FRotator& Rotation)
+{
+	bPooled = false;
+
+	SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+	SetActorHiddenInGame(false);
+	SetActorTickEnabled(true);
+
+	if (ProjectileMovement)
+	{
+		ProjectileMovement->SetUpdatedComponent(CollisionSphere);
+		ProjectileMovement->Activate(true);
 	}
 }
 
 void ACC_Projectile::OnOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
 	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
-	if (!OtherActor || OtherActor == this || OtherActor == ProjectileOwner)
+	// Released earlier in the same sweep
+	if (bPooled || !OtherActor || OtherActor == this || OtherActor == ProjectileOwner)
 	{
 		return;
 	}
@@ -191,12 +262,12 @@ void ACC_Projectile::OnOverlapBegin(UPrimitiveComponent* OverlappedComponent, AA
 		CurrentPierceCount++;
 		if (PierceCount > 0 && CurrentPierceCount >= PierceCount)
 		{
-			Destroy();
+			ReturnToPool();
 		}
 	}
 	else if (bDestroyOnHit)
 	{
-		Destroy();
+		ReturnToPool();
 	}
 }
 
@@ -76,10 +76,15 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile|Stats")
 	float Speed;
 
-	// Max lifetime before auto-destroy (seconds)
+	// Max lifetime before it returns to the pool (seconds, restarted by InitializeProjectile)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile|Stats")
 	float Lifetime;
 
+	FTimerHandle LifetimeTimer;
+
+	// Parked in UCC_ProjectilePoolSubsystem
+	bool bPooled = false;
+
 	// Should destroy on hit?
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile|Behavior")
 	bool bDestroyOnHit;
@@ -131,9 +136,27 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Projectile")
 	void SetProjectileOwner(AActor* NewOwner);
 
-	// Initialize projectile with custom damage
+	// Set up a shot (fresh or pooled): damage, speed (class default when 0), owner, pierce count, lifetime, launch
 	UFUNCTION(BlueprintCallable, Category = "Projectile")
-	void InitializeProjectile(float InDamage, float InSpeed = 0.0f);
+	void InitializeProjectile(float InDamage, float InSpeed = 0.0f, AActor* InOwner = nullptr);
+
+	float GetLifetime() const { return Lifetime; }
+
+	//==========================================================================
+	// POOLING (UCC_ProjectilePoolSubsystem)
+	//==========================================================================
+
+	// Hit or expired: back to the pool (destroyed when there is none)
+	UFUNCTION(BlueprintCallable, Category = "Projectile")
+	void ReturnToPool();
+
+	// Hidden, no collision, no movement, no tick - waits for reuse
+	void DeactivateToPool();
+
+	// Out of the pool at the transform, visible (collision and launch wait for InitializeProjectile)
+	void ActivateFromPool(const FVector& Location, const FRotator& Rotation);
+
+	bool IsPooled() const { return bPooled; }
 
 
 protected:
@@ -6,6 +6,7 @@
 #include "TimerManager.h"
 #include "NiagaraFunctionLibrary.h"
 #include "CC_Projectile.h"
+#include "../CC_ProjectilePoolSubsystem.h"
 #include "../CC_EnemyManager.h"
 #include "../CC_SearchingComponent.h"
 #include "../Characters/CC_PlayerCharacter.h"
@@ -30,6 +31,7 @@ ACC_Weapon::ACC_Weapon()
 	bCanAttack = true;                    // Ready to attack
 	LastAttackTime = 0.0f;                // No previous attack
 	WeaponOwner = nullptr;                // No owner yet
+	EnemyManager = nullptr;
 
 	// Initialize effects (set in Blueprint or child classes)
 	AttackEffect = nullptr;
@@ -42,6 +44,7 @@ void ACC_Weapon::BeginPlay()
 {
 	Super::BeginPlay();
 	
+	EnemyManager = ACC_EnemyManager::Get(this);
 }
 
 // Called every frame
@@ -104,6 +107,28 @@ void ACC_Weapon::OnEquipped(AActor* NewOwner)
 		AttachToActor(WeaponOwner, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
 		UE_LOG(LogTemp, Log, TEXT("Weapon equipped and attached to: %s"), *WeaponOwner->GetName());
 	}
+
+	PrewarmProjectiles();
+}
+
+void ACC_Weapon::PrewarmProjectiles()
+{
+	if (!ProjectileClass || !WeaponOwner)
+	{
+		return;
+	}
+
+	UCC_ProjectilePoolSubsystem* Pool = UCC_ProjectilePoolSubsystem::Get(this);
+	if (!Pool)
+	{
+		return;
+	}
+
+	// Projectiles alive at once at full fire rate: shots per second * projectiles per shot * lifetime
+	const float Lifetime = ProjectileClass->GetDefaultObject<ACC_Projectile>()->GetLifetime();
+	const int32 InFlight = FMath::CeilToInt(BaseStats.AttackSpeed * GetFinalProjectileCount() * Lifetime);
+
+	Pool->Prewarm(ProjectileClass, InFlight + ProjectilePrewarmMargin, WeaponOwner->GetActorLocation());
 }
 
 void ACC_Weapon::OnUnequipped()
@@ -219,26 +244,20 @@ void ACC_Weapon::SpawnProjectile(const FVector& SpawnLocation, const FRotator& S
 		return;
 	}
 
-	// Spawn parameters
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.Owner = WeaponOwner;
-	SpawnParams.Instigator = Cast<APawn>(WeaponOwner);
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-	// Spawn projectile
-	ACC_Projectile* Projectile = GetWorld()->SpawnActor<ACC_Projectile>(
-		ProjectileClass,
-		SpawnLocation,
-		SpawnRotation,
-		SpawnParams
-	);
+	UCC_ProjectilePoolSubsystem* Pool = UCC_ProjectilePoolSubsystem::Get(this);
+	if (!Pool)
+	{
+		return;
+	}
+
+	// Pooled projectile when one is free, a new actor otherwise
+	ACC_Projectile* Projectile = Pool->AcquireProjectile(ProjectileClass, SpawnLocation, SpawnRotation, WeaponOwner);
 
 	if (Projectile)
 	{
 		// Initialize projectile with weapon's damage and speed
 		float FinalDamage = CalculateFinalDamage();
-		Projectile->InitializeProjectile(FinalDamage, RangedStats.ProjectileSpeed);
-		Projectile->SetProjectileOwner(WeaponOwner);
+		Projectile->InitializeProjectile(FinalDamage, RangedStats.ProjectileSpeed, WeaponOwner);
 
 		UE_LOG(LogTemp, Log, TEXT("Spawned projectile: Damage=%.1f, Speed=%.1f"),
 			FinalDamage, RangedStats.ProjectileSpeed);
@@ -295,8 +314,12 @@ FVector ACC_Weapon::GetFiringDirection() const
 		AActor* NearestEnemy = FindNearestEnemy();
 		if (NearestEnemy)
 		{
-			// Aim towards nearest enemy
-			FVector Direction = (NearestEnemy->GetActorLocation() - WeaponOwner->GetActorLocation()).GetSafeNormal();
+			// Aim towards nearest enemy (closest image across wrap seams)
+			const FVector OwnerLocation = WeaponOwner->GetActorLocation();
+			const FVector TargetLocation = EnemyManager
+				? EnemyManager->GetNearestImageLocation(OwnerLocation, NearestEnemy->GetActorLocation())
+				: NearestEnemy->GetActorLocation();
+			FVector Direction = (TargetLocation - OwnerLocation).GetSafeNormal();
 			return Direction;
 		}
 	}
@@ -345,6 +368,48 @@ TArray<AActor*> ACC_Weapon::GetEnemiesInCone(FVector Direction, float Range, flo
 	return Searching->GetEnemiesInCone(OwnerLocation, Direction, Range, Angle);
 }
 
+int32 ACC_Weapon::FindRandomEnemies(float SearchRadius, int32 Count, TArray<AActor*>& OutEnemies)
+{
+	OutEnemies.Reset();
+	UCC_SearchingComponent* Searching = GetSearchingComponent();
+	if (!Searching || !WeaponOwner) return 0;
+
+	return Searching->FindRandomEnemies(WeaponOwner->GetActorLocation(), SearchRadius, Count, OutEnemies);
+}
+
+int32 ACC_Weapon::GetEnemiesInRadius(float Radius, TArray<AActor*>& OutEnemies)
+{
+	OutEnemies.Reset();
+	UCC_SearchingComponent* Searching = GetSearchingComponent();
+	if (!Searching || !WeaponOwner) return 0;
+
+	return Searching->GetEnemiesInSphere(WeaponOwner->GetActorLocation(), Radius, OutEnemies);
+}
+
+int32 ACC_Weapon::GetEnemiesInCone(FVector Direction, float Range, float Angle, TArray<AActor*>& OutEnemies)
+{
+	OutEnemies.Reset();
+	UCC_SearchingComponent* Searching = GetSearchingComponent();
+	if (!Searching || !WeaponOwner) return 0;
+
+	return Searching->GetEnemiesInCone(WeaponOwner->GetActorLocation(), Direction, Range, Angle, OutEnemies);
+}
+
+FCC_EnemyQueryHandle ACC_Weapon::SubmitTargetQuery(const FCC_EnemyQueryRequest& Request, FCC_EnemyQueryCallback OnResolved)
+{
+	if (!EnemyManager)
+	{
+		EnemyManager = ACC_EnemyManager::Get(this);
+		if (!EnemyManager)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[WEAPON] No EnemyManager for targeting query!"));
+			return FCC_EnemyQueryHandle();
+		}
+	}
+
+	return EnemyManager->SubmitQuery(this, Request, MoveTemp(OnResolved));
+}
+
 TArray<FRotator> ACC_Weapon::CalculateSpreadRotations(const FRotator& BaseRotation, int32 Count, float Spread) const
 {
 	TArray<FRotator> Rotations;
@@ -6,6 +6,7 @@
 #include "GameFramework/Actor.h"
 #include "NiagaraSystem.h"
 #include "../CristalCubeStruct.h"
+#include "../CC_EnemyQueryBatch.h"
 #include "CC_Weapon.generated.h"
 
 UCLASS()
@@ -64,6 +65,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weapon|Ranged", meta = (EditCondition = "BaseStats.WeaponCategory == EWeaponCategory::Ranged", EditConditionHides))
 	TSubclassOf<class ACC_Projectile> ProjectileClass;
 
+	// Extra pooled projectiles on top of the in-flight estimate made on equip
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weapon|Ranged", meta = (ClampMin = "0", EditCondition = "BaseStats.WeaponCategory == EWeaponCategory::Ranged", EditConditionHides))
+	int32 ProjectilePrewarmMargin = 8;
+
 	// Enable auto-aim to nearest enemy
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weapon|Ranged", meta = (EditCondition = "BaseStats.WeaponCategory == EWeaponCategory::Ranged", EditConditionHides))
 	bool bAutoAim;
@@ -151,6 +156,9 @@ protected:
 	// Spawn a single projectile
 	void SpawnProjectile(const FVector& SpawnLocation, const FRotator& SpawnRotation);
 
+	// Fill the projectile pool for this weapon's fire rate (on equip)
+	void PrewarmProjectiles();
+
 	// Spawn multiple projectiles with spread
 	void SpawnMultipleProjectiles(const FVector& SpawnLocation, const FRotator& BaseRotation, int32 Count);
 
@@ -173,6 +181,18 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Weapon|Targeting")
 	TArray<AActor*> GetEnemiesInCone(FVector Direction, float Range, float Angle);
 
+	// Caller-owned buffer versions - keep the array as a member to avoid allocating per attack
+	int32 FindRandomEnemies(float SearchRadius, int32 Count, TArray<AActor*>& OutEnemies);
+	int32 GetEnemiesInRadius(float Radius, TArray<AActor*>& OutEnemies);
+	int32 GetEnemiesInCone(FVector Direction, float Range, float Angle, TArray<AActor*>& OutEnemies);
+
+	// Batched targeting - resolved by the enemy manager together with every other
+	// query of this frame (callback runs the same frame, skipped if this weapon is gone)
+	FCC_EnemyQueryHandle SubmitTargetQuery(const FCC_EnemyQueryRequest& Request, FCC_EnemyQueryCallback OnResolved);
+
+	UPROPERTY()
+	class ACC_EnemyManager* EnemyManager;
+
 	// Calculate spread rotations
 	TArray<FRotator> CalculateSpreadRotations(const FRotator& BaseRotation, int32 Count, float Spread) const;
 
@@ -7,6 +7,9 @@
 #include "../../CC_LogHelper.h"
 #include "NiagaraFunctionLibrary.h"
 #include "Engine/DamageEvents.h"
+#include "../../CC_Stats.h"
+
+DECLARE_CYCLE_STAT(TEXT("BasicMagic Targeting"), STAT_CC_BasicMagicTargeting, STATGROUP_CristalCube);
 
 
 ACC_BasicMagic::ACC_BasicMagic()
@@ -79,48 +82,65 @@ void ACC_BasicMagic::ExecuteMagicAttack()
 
 void ACC_BasicMagic::ExecuteSingleTarget()
 {
-	AActor* Target = FindNearestEnemy(SearchRadius);
+    TRACE_CPUPROFILER_EVENT_SCOPE(ACC_BasicMagic::ExecuteSingleTarget);
+    SCOPE_CYCLE_COUNTER(STAT_CC_BasicMagicTargeting);
 
-    if (!Target)
-    {
-        if (bRequireTarget)
+    SubmitTargetQuery(
+        FCC_EnemyQueryRequest::CachedNearest(WeaponOwner->GetActorLocation(), SearchRadius),
+        [this](const TArray<AActor*>& Targets)
         {
-            CC_LOG_WEAPON(Warning, "[Magic] No target (Single Mode)");
-            return;
-        }
+            TRACE_CPUPROFILER_EVENT_SCOPE(ACC_BasicMagic::OnTargetResolved);
 
-		Target = WeaponOwner;
+            AActor* Target = Targets.Num() > 0 ? Targets[0] : nullptr;
 
-    }
+            if (!Target)
+            {
+                if (bRequireTarget || !WeaponOwner)
+                {
+                    CC_LOG_WEAPON(Warning, "[Magic] No target (Single Mode)");
+                    return;
+                }
+
+                Target = WeaponOwner;
+            }
 
-    FVector TargetLocation = Target->GetActorLocation();
-	ApplyMagicDamage(TargetLocation);
+            FVector TargetLocation = Target->GetActorLocation();
+            ApplyMagicDamage(TargetLocation);
 
-	CC_LOG_WEAPON(Log, "[Magic] Single Target at %s", *Target->GetName());
+            CC_LOG_WEAPON(Log, "[Magic] Single Target at %s", *Target->GetName());
+        });
 }
 
 void ACC_BasicMagic::ExecuteMultiTarget()
 {
-	TArray<AActor*> Targets = FindRandomEnemies(SearchRadius, MaxTargets);
+    TRACE_CPUPROFILER_EVENT_SCOPE(ACC_BasicMagic::ExecuteMultiTarget);
+    SCOPE_CYCLE_COUNTER(STAT_CC_BasicMagicTargeting);
 
-    if (Targets.Num() == 0)
-    {
-        if (bRequireTarget)
+    SubmitTargetQuery(
+        FCC_EnemyQueryRequest::Random(WeaponOwner->GetActorLocation(), SearchRadius, MaxTargets),
+        [this](const TArray<AActor*>& Targets)
         {
-            CC_LOG_WEAPON(Warning, "[Magic] No targets (Multi Mode)");
-            return;
-        }
-		ApplyMagicDamage(WeaponOwner->GetActorLocation());
-        return;
-    }
+            TRACE_CPUPROFILER_EVENT_SCOPE(ACC_BasicMagic::OnTargetsResolved);
 
-    for(AActor* Target : Targets)
-    {
-        if (Target)
-        {
-			ApplyMagicDamage(Target->GetActorLocation());
-        }
-	}
+            if (Targets.Num() == 0)
+            {
+                if (bRequireTarget || !WeaponOwner)
+                {
+                    CC_LOG_WEAPON(Warning, "[Magic] No targets (Multi Mode)");
+                    return;
+                }
+                ApplyMagicDamage(WeaponOwner->GetActorLocation());
+                return;
+            }
+
+            for (AActor* Target : Targets)
+            {
+                if (Target)
+                {
+                    ApplyMagicDamage(Target->GetActorLocation());
+                }
+            }
+        });
 }
 
 void ACC_BasicMagic::ExecuteAreaTarget()
@@ -188,32 +208,46 @@ void ACC_BasicMagic::ApplyMagicDamage(const FVector& Location)
         );
     }
 
+    // Damage lands after a short delay, hit enemies come from the batched query at the impact point
     FTimerHandle DamageDelayTimer;
     GetWorld()->GetTimerManager().SetTimer(
         DamageDelayTimer,
-        [this, Location]()
+        FTimerDelegate::CreateWeakLambda(this, [this, Location]()
         {
-            TArray<AActor*> HitEnemies = GetEnemiesInRadius(MagicStats.EffectRadius);
-
-            float FinalDamage = CalculateFinalDamage();
+            TRACE_CPUPROFILER_EVENT_SCOPE(ACC_BasicMagic::SubmitDamageQuery);
+            SCOPE_CYCLE_COUNTER(STAT_CC_BasicMagicTargeting);
 
-            for (AActor* Enemy : HitEnemies)
-            {
-                if (Enemy && Enemy->ActorHasTag("Enemy"))
+            SubmitTargetQuery(
+                FCC_EnemyQueryRequest::InShape(FCC_EnemyShapeQuery::MakeSphere(Location, MagicStats.EffectRadius)),
+                [this](const TArray<AActor*>& HitEnemies)
                 {
-                    FDamageEvent DamageEvent;
-                    Enemy->TakeDamage(
-                        FinalDamage,
-                        DamageEvent,
-                        WeaponOwner->GetInstigatorController(),
-                        WeaponOwner
-                    );
-                }
-
-                CC_LOG_WEAPON(Log, TEXT("Magic hit %s for %.1f damage"),
-                    *Enemy->GetName(), FinalDamage);
-            }
-        },
+                    TRACE_CPUPROFILER_EVENT_SCOPE(ACC_BasicMagic::OnHitsResolved);
+
+                    if (!WeaponOwner)
+                    {
+                        return;
+                    }
+
+                    float FinalDamage = CalculateFinalDamage();
+
+                    for (AActor* Enemy : HitEnemies)
+                    {
+                        if (Enemy && Enemy->ActorHasTag("Enemy"))
+                        {
+                            FDamageEvent DamageEvent;
+                            Enemy->TakeDamage(
+                                FinalDamage,
+                                DamageEvent,
+                                WeaponOwner->GetInstigatorController(),
+                                WeaponOwner
+                            );
+
+                            CC_LOG_WEAPON(Log, TEXT("Magic hit %s for %.1f damage"),
+                                *Enemy->GetName(), FinalDamage);
+                        }
+                    }
+                });
+        }),
         0.2f,
         false
     );
@@ -4,8 +4,12 @@
 #include "CC_BasicSword.h"
 #include "DrawDebugHelpers.h"
 #include "../../CC_LogHelper.h"
+#include "../../CC_EnemyManager.h"
+#include "../../CC_Stats.h"
 #include "Engine/DamageEvents.h"
 
+DECLARE_CYCLE_STAT(TEXT("BasicSword Targeting"), STAT_CC_BasicSwordTargeting, STATGROUP_CristalCube);
+
 ACC_BasicSword::ACC_BasicSword()
 {
 	// Weapon info
@@ -42,6 +46,8 @@ void ACC_BasicSword::Attack()
 
 void ACC_BasicSword::ExecuteSwordAttack()
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(ACC_BasicSword::ExecuteSwordAttack);
+
 	if(!WeaponOwner)
 	{
 		CC_LOG_WEAPON(Warning, "No Weapon Owner");
@@ -75,57 +81,56 @@ void ACC_BasicSword::ExecuteSwordAttack()
         HitData.Height * 0.5f      // Z 
     );
 
-    // Perform overlap
-    TArray<FOverlapResult> OverlapResults;
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(WeaponOwner);
-    QueryParams.AddIgnoredActor(this);
-
-    bool bHit = GetWorld()->OverlapMultiByChannel(
-        OverlapResults,
-        BoxCenter,
-        OwnerRotation.Quaternion(),
-        ECC_Pawn,
-        FCollisionShape::MakeBox(BoxExtent),
-        QueryParams
-    );
-
-    // Apply damage
-    if (bHit)
-    {
-        float FinalDamage = CalculateFinalDamage();
+    // Enemy positions are centers - pad by the capsule radius so the hit test
+    // behaves like the old physics overlap
+    const float EnemyRadius = EnemyManager ? EnemyManager->GetMaxEnemyRadius() : 0.0f;
+    const FVector QueryExtent = BoxExtent + FVector(EnemyRadius, EnemyRadius, 0.0f);
 
-        for (const FOverlapResult& Result : OverlapResults)
+    SCOPE_CYCLE_COUNTER(STAT_CC_BasicSwordTargeting);
+    SubmitTargetQuery(
+        FCC_EnemyQueryRequest::InShape(FCC_EnemyShapeQuery::MakeBox(BoxCenter, QueryExtent, OwnerRotation)),
+        [this, BoxCenter, BoxExtent, OwnerRotation](const TArray<AActor*>& HitEnemies)
         {
-            AActor* HitActor = Result.GetActor();
-            if (HitActor && HitActor->ActorHasTag("Enemy"))
+            TRACE_CPUPROFILER_EVENT_SCOPE(ACC_BasicSword::OnHitsResolved);
+
+            const bool bHit = HitEnemies.Num() > 0;
+
+            // Apply damage
+            if (bHit && WeaponOwner)
             {
-                FDamageEvent DamageEvent;
-                HitActor->TakeDamage(
-                    FinalDamage,
-                    DamageEvent,
-                    WeaponOwner->GetInstigatorController(),
-                    WeaponOwner
-                );
-
-                UE_LOG(LogTemp, Log, TEXT("[SWORD] Hit %s for %.1f damage"),
-                    *HitActor->GetName(), FinalDamage);
+                float FinalDamage = CalculateFinalDamage();
+
+                for (AActor* HitActor : HitEnemies)
+                {
+                    if (HitActor && HitActor->ActorHasTag("Enemy"))
+                    {
+                        FDamageEvent DamageEvent;
+                        HitActor->TakeDamage(
+                            FinalDamage,
+                            DamageEvent,
+                            WeaponOwner->GetInstigatorController(),
+                            WeaponOwner
+                        );
+
+                        UE_LOG(LogTemp, Log, TEXT("[SWORD] Hit %s for %.1f damage"),
+                            *HitActor->GetName(), FinalDamage);
+                    }
+                }
             }
-        }
-    }
 
-    // Debug visualization
+            // Debug visualization
 #if !UE_BUILD_SHIPPING
-    DrawDebugBox(
-        GetWorld(),
-        BoxCenter,
-        BoxExtent,
-        OwnerRotation.Quaternion(),
-        bHit ? FColor::Green : FColor::Red,
-        false,
-        0.3f,
-        0,
-        2.0f
-    );
+            DrawDebugBox(
+                GetWorld(),
+                BoxCenter,
+                BoxExtent,
+                OwnerRotation.Quaternion(),
+                bHit ? FColor::Green : FColor::Red,
+                false,
+                0.3f,
+                0,
+                2.0f
+            );
 #endif
+        });
 }
@@ -4,7 +4,11 @@
 #include "CC_BasicGun.h"
 #include "../CC_Projectile.h"
 #include "../../CC_SearchingComponent.h"
+#include "../../CC_EnemyManager.h"
 #include "../../CC_LogHelper.h"
+#include "../../CC_Stats.h"
+
+DECLARE_CYCLE_STAT(TEXT("BasicGun Targeting"), STAT_CC_BasicGunTargeting, STATGROUP_CristalCube);
 
 
 ACC_BasicGun::ACC_BasicGun()
@@ -55,13 +59,38 @@ void ACC_BasicGun::Attack()
 
 void ACC_BasicGun::ExecuteGunAttack()
 {
-    AActor* Target = FindNearestEnemy(AutoAimRadius);
+    TRACE_CPUPROFILER_EVENT_SCOPE(ACC_BasicGun::ExecuteGunAttack);
+
     CC_LOG_WEAPON(Log, TEXT("[GUN] ExecuteGunAttack is Called"));
 
-    if (!Target) return;
+    if (!WeaponOwner) return;
+
+    // Auto-aim target is resolved with the other weapons' queries at the end of the frame
+    // (usually straight from the target cache - same target as the last shot)
+    SCOPE_CYCLE_COUNTER(STAT_CC_BasicGunTargeting);
+    SubmitTargetQuery(
+        FCC_EnemyQueryRequest::CachedNearest(WeaponOwner->GetActorLocation(), AutoAimRadius),
+        [this](const TArray<AActor*>& Targets)
+        {
+            TRACE_CPUPROFILER_EVENT_SCOPE(ACC_BasicGun::OnTargetResolved);
+
+            if (Targets.Num() > 0)
+            {
+                FireAtTarget(Targets[0]);
+            }
+        });
+}
+
+void ACC_BasicGun::FireAtTarget(AActor* Target)
+{
+    if (!Target || !WeaponOwner) return;
  
-    FVector TargetLocation = Target->GetActorLocation();
     FVector OwnerLocation = WeaponOwner->GetActorLocation();
+
+    // Aim at the closest image - the target may be just across a wrap seam
+    FVector TargetLocation = EnemyManager
+        ? EnemyManager->GetNearestImageLocation(OwnerLocation, Target->GetActorLocation())
+        : Target->GetActorLocation();
     FRotator AimRotation = (TargetLocation - OwnerLocation).Rotation();
 
     // Get final projectile count (base + upgrades)
@@ -87,29 +116,7 @@ void ACC_BasicGun::ExecuteGunAttack()
 
     for (const FRotator& Rotation : SpreadRotations)
     {
-        if (ProjectileClass)
-        {
-            FActorSpawnParameters SpawnParams;
-            SpawnParams.Owner = WeaponOwner;
-            SpawnParams.Instigator = Cast<APawn>(WeaponOwner);
-            SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-            ACC_Projectile* Projectile = GetWorld()->SpawnActor<ACC_Projectile>(
-                ProjectileClass,
-                SpawnLocation,
-                Rotation,
-                SpawnParams
-            );
-
-            if (Projectile)
-            {
-                float FinalDamage = CalculateFinalDamage();
-                Projectile->InitializeProjectile(FinalDamage, RangedStats.ProjectileSpeed);
-                Projectile->SetProjectileOwner(WeaponOwner);
-
-                UE_LOG(LogTemp, Log, TEXT("Spawned projectile: Damage=%.1f, Speed=%.1f"),
-                    FinalDamage, RangedStats.ProjectileSpeed);
-            }
-        }
+        // Pooled (ACC_Weapon::SpawnProjectile)
+        SpawnProjectile(SpawnLocation, Rotation);
     }
 }
@@ -23,4 +23,7 @@ public:
 protected:
 
 	void ExecuteGunAttack();
+
+	// Called when the batched auto-aim query resolves
+	void FireAtTarget(AActor* Target);
 };